@@ -0,0 +1,290 @@
+/** ************************************************************************
+   @project      options library
+   @file         options_generator.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   @brief        Generates a header with a struct of typed options from a schema.
+
+   The schema file uses the format read by OptionsSchema (the tester's
+   "options.txt" format). The generated struct holds a member per option,
+   the schema as a static table, and methods for building the options
+   (fill), copying their values into the members (assign), and for parsing
+   and loading them (parseAndLoad). Call it as:
+      options_generator <SCHEMA> <HEADER> <STRUCT_NAME>
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <iostream>
+#include <string>
+#include <vector>
+#include <set>
+#include <sstream>
+#include <cctype>
+#include <stdexcept>
+
+#include <utils/options/OptionsSchema.h>
+#include <utils/options/OptionsFileWriter.h>
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef WANT_MEMCHECK
+#include <foreign/nvwa/debug_new.h>
+#endif // WANT_MEMCHECK
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * enum definitions
+ * ======================================================================= */
+enum ReturnCodes {
+    STAT_OK = 0,
+    STAT_WRONG_USAGE = 1,
+    STAT_MISSING_SCHEMA = 2,
+    STAT_FALSE_SCHEMA = 3,
+    STAT_WRITE_ERROR = 4
+};
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+/** @brief Returns the given string as a C++ string literal
+ * @param[in] str The string to quote
+ * @return The quoted and escaped string
+ */
+std::string
+quote(const std::string &str) {
+    std::string ret = "\"";
+    for(std::string::const_iterator i=str.begin(); i!=str.end(); ++i) {
+        if(*i=='"' || *i=='\\') {
+            ret += '\\';
+            ret += *i;
+        } else if(*i=='\t') {
+            ret += "\\t";
+        } else if(*i=='\r' || *i=='\n') {
+            // schema lines do not contain line breaks
+        } else {
+            ret += *i;
+        }
+    }
+    return ret + "\"";
+}
+
+
+/** @brief Returns the name of the struct member that holds the named option
+ * @param[in] name The option's name
+ * @return An identifier made of the name
+ */
+std::string
+getMemberName(const std::string &name) {
+    static const char *keywords[] = {
+        "auto", "bool", "break", "case", "catch", "char", "class", "const", "continue", "default",
+        "delete", "do", "double", "else", "enum", "explicit", "extern", "false", "float", "for",
+        "friend", "goto", "if", "inline", "int", "long", "namespace", "new", "operator", "private",
+        "protected", "public", "register", "return", "short", "signed", "sizeof", "static", "struct", "switch",
+        "template", "this", "throw", "true", "try", "typedef", "union", "unsigned", "using", "virtual",
+        "void", "volatile", "while", 0
+    };
+    std::string ret;
+    for(std::string::const_iterator i=name.begin(); i!=name.end(); ++i) {
+        ret += isalnum((unsigned char) *i) ? *i : '_';
+    }
+    if(ret.length()==0 || isdigit((unsigned char) ret[0])) {
+        ret = "_" + ret;
+    }
+    for(const char **keyword=keywords; *keyword!=0; ++keyword) {
+        if(ret==*keyword) {
+            return ret + "_";
+        }
+    }
+    return ret;
+}
+
+
+/** @brief Returns the schema line the given entry was read from
+ * @param[in] entry The schema entry
+ * @return The entry as a schema line
+ */
+std::string
+getSchemaLine(const OptionsSchema::Entry &entry) {
+    std::string ret = entry.type;
+    if(entry.abbr!=0) {
+        ret = ret + ";" + entry.abbr;
+    }
+    for(std::vector<std::string>::const_iterator i=entry.names.begin(); i!=entry.names.end(); ++i) {
+        ret += ";" + *i;
+    }
+    for(std::vector<std::string>::const_iterator i=entry.choices.begin(); i!=entry.choices.end(); ++i) {
+        ret += ";=" + *i;
+    }
+    if(entry.defaultValue.length()!=0) {
+        ret += ";+" + entry.defaultValue;
+    }
+    if(entry.description.length()!=0) {
+        ret += ";!" + entry.description;
+    }
+    return ret;
+}
+
+
+/** @brief Writes the struct for the given schema
+ * @param[in] schema The schema to write the struct for
+ * @param[in] schemaName The name of the schema file
+ * @param[in] structName The name of the struct
+ * @param[out] into The writer to write the header into
+ * @throw runtime_error If two options are mapped onto the same member
+ */
+void
+writeStruct(const OptionsSchema &schema, const std::string &schemaName, const std::string &structName, OptionsFileWriter &into) {
+    const std::vector<OptionsSchema::Entry> &entries = schema.getEntries();
+    std::vector<const OptionsSchema::Entry*> options;
+    std::set<std::string> members;
+    for(std::vector<OptionsSchema::Entry>::const_iterator i=entries.begin(); i!=entries.end(); ++i) {
+        if(OptionsSchema::isOptionType((*i).type)) {
+            if(!members.insert(getMemberName((*i).names[0])).second) {
+                throw std::runtime_error("The option '" + (*i).names[0] + "' is mapped onto the member '" + getMemberName((*i).names[0]) + "' that is already used.");
+            }
+            options.push_back(&*i);
+        }
+    }
+    std::string guard = getMemberName(structName) + "_h";
+    into.append("#ifndef " + guard + "\n#define " + guard + "\n");
+    into.append("/* generated by options_generator from '" + schemaName + "'; do not edit */\n\n");
+    into.append("#include <string>\n#include <cstdlib>\n");
+    into.append("#include <utils/options/OptionsCont.h>\n");
+    into.append("#include <utils/options/OptionsIO.h>\n");
+    into.append("#include <utils/options/OptionsSchema.h>\n\n\n");
+    into.append("/**\n * @struct " + structName + "\n * @brief The values of the options defined in '" + schemaName + "'\n */\n");
+    into.append("struct " + structName + " {\n");
+    // members
+    for(std::vector<const OptionsSchema::Entry*>::const_iterator i=options.begin(); i!=options.end(); ++i) {
+        const OptionsSchema::Entry &entry = **i;
+        std::string type = entry.type=="INT" || entry.type=="ENUM" ? "int" : entry.type=="LONG" ? "long long" : entry.type=="DOUBLE" ? "double" : entry.type=="BOOL" ? "bool" : "std::string";
+        into.append("    /// @brief " + (entry.description.length()!=0 ? entry.description : "Option '" + entry.names[0] + "'") + "\n");
+        into.append("    " + type + " " + getMemberName(entry.names[0]) + ";\n\n");
+    }
+    // constructor
+    into.append("\n    /// @brief Constructor, sets the defaults\n    " + structName + "()");
+    std::string divider = "\n        : ";
+    for(std::vector<const OptionsSchema::Entry*>::const_iterator i=options.begin(); i!=options.end(); ++i) {
+        const OptionsSchema::Entry &entry = **i;
+        std::string value;
+        if(entry.type=="INT") {
+            value = entry.defaultValue.length()!=0 ? "atoi(" + quote(entry.defaultValue) + ")" : "0";
+        } else if(entry.type=="LONG") {
+            value = entry.defaultValue.length()!=0 ? "strtoll(" + quote(entry.defaultValue) + ", 0, 0)" : "0";
+        } else if(entry.type=="DOUBLE") {
+            value = entry.defaultValue.length()!=0 ? "atof(" + quote(entry.defaultValue) + ")" : "0.";
+        } else if(entry.type=="BOOL") {
+            value = "false";
+        } else if(entry.type=="ENUM") {
+            // the code of the default literal, -1 if none is given
+            value = "-1";
+            for(size_t j=0; j<entry.choices.size(); ++j) {
+                if(entry.choices[j]==entry.defaultValue) {
+                    std::ostringstream code;
+                    code << j;
+                    value = code.str();
+                }
+            }
+        } else {
+            value = quote(entry.defaultValue);
+        }
+        into.append(divider + getMemberName(entry.names[0]) + "(" + value + ")");
+        divider = ", ";
+    }
+    into.append(" { }\n\n\n");
+    // registration table
+    into.append("    /** @brief Returns the schema's lines\n     * @return The lines, terminated by 0\n     */\n");
+    into.append("    static const char * const *getSchemaLines() {\n        static const char * const lines[] = {\n");
+    for(std::vector<OptionsSchema::Entry>::const_iterator i=entries.begin(); i!=entries.end(); ++i) {
+        into.append("            " + quote(getSchemaLine(*i)) + ",\n");
+    }
+    into.append("            0\n        };\n        return lines;\n    }\n\n\n");
+    into.append("    /** @brief Returns the name of the option that names the configuration\n     * @return The configuration option's name, empty if not given\n     */\n");
+    into.append("    static const char *getConfigOptionName() {\n        return " + quote(schema.getConfigOptionName()) + ";\n    }\n\n\n");
+    into.append("    /** @brief Returns the prefix of the environment variables to read options from\n     * @return The prefix, empty if options are not read from the environment\n     */\n");
+    into.append("    static const char *getEnvPrefix() {\n        return " + quote(schema.getEnvPrefix()) + ";\n    }\n\n\n");
+    into.append("    /** @brief Builds the defined options in the given container\n     * @param[in] into The container to add the options to\n     */\n");
+    into.append("    static void fill(OptionsCont &into) {\n        OptionsSchema schema;\n        schema.add(getSchemaLines());\n        schema.fill(into);\n    }\n\n\n");
+    // assignment
+    into.append("    /** @brief Copies the values of the set options into the members\n     * @param[in] from The container to read the values from\n     */\n");
+    into.append("    void assign(const OptionsCont &from) {\n");
+    for(std::vector<const OptionsSchema::Entry*>::const_iterator i=options.begin(); i!=options.end(); ++i) {
+        const OptionsSchema::Entry &entry = **i;
+        std::string getter = entry.type=="INT" ? "getInteger" : entry.type=="LONG" ? "get<long long>" : entry.type=="ENUM" ? "getEnum" : entry.type=="DOUBLE" ? "getDouble" : entry.type=="BOOL" ? "getBool" : "getString";
+        into.append("        if(from.isSet(" + quote(entry.names[0]) + ")) {\n");
+        into.append("            " + getMemberName(entry.names[0]) + " = from." + getter + "(" + quote(entry.names[0]) + ");\n");
+        into.append("        }\n");
+    }
+    into.append("    }\n\n\n");
+    // parse and load glue
+    into.append("    /** @brief Parses the command line, loads the configuration, and copies the values into the members\n");
+    into.append("     * @param[in] into The options container to fill (see fill)\n");
+    into.append("     * @param[in] argc The number of arguments given on the command line\n");
+    into.append("     * @param[in] argv The arguments given on the command line\n");
+    into.append("     * @param[in] fileIO The file reading handler to use\n");
+    into.append("     * @return Whether parsing and loading was successful\n     */\n");
+    into.append("    bool parseAndLoad(OptionsCont &into, int argc, char **argv, OptionsTypedFileIO &fileIO) {\n");
+    if(schema.getEnvPrefix().length()!=0) {
+        into.append("        if(!OptionsIO::parseAndLoad(into, argc, argv, getEnvPrefix(), fileIO, getConfigOptionName())) {\n            return false;\n        }\n");
+    } else {
+        into.append("        if(!OptionsIO::parseAndLoad(into, argc, argv, fileIO, getConfigOptionName())) {\n            return false;\n        }\n");
+    }
+    into.append("        assign(into);\n        return true;\n    }\n\n};\n\n\n#endif\n");
+}
+
+
+int
+main(int argc, char *argv[]) {
+    if(argc!=4) {
+        std::cerr << "Usage: options_generator <SCHEMA> <HEADER> <STRUCT_NAME>" << std::endl;
+        return STAT_WRONG_USAGE;
+    }
+    ReturnCodes ret = STAT_OK;
+    try {
+        OptionsSchema schema;
+        if(!schema.read(argv[1])) {
+            ret = STAT_MISSING_SCHEMA;
+        } else {
+            OptionsFileWriter writer;
+            writeStruct(schema, argv[1], argv[3], writer);
+            if(!writer.writeAtomically(argv[2])) {
+                ret = STAT_WRITE_ERROR;
+            }
+        }
+    } catch(std::runtime_error &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        ret = STAT_FALSE_SCHEMA;
+    }
+    if(ret!=STAT_OK) {
+        cerr << "Quitting (on error)." << endl;
+    }
+    return ret;
+}
+
+
+// *************************************************************************
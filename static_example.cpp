@@ -0,0 +1,113 @@
+/** ************************************************************************
+   @project      options library
+   @file         static_example.cpp
+   @since        19.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2019-2021
+   @brief        The "Hello World"-example using a compile-time schema.
+
+   Behaves like example.cpp, but declares the options using
+   OptionsStaticSchema. The name may be given using --name <NAME>,
+   --user <NAME>, or -n <NAME>, the greet using --greet <GREET>,
+   --salutation <GREET>, or -g <GREET>, and the number of repetitions
+   using --repeat <INT>, --times <INT>, or -r <INT>.
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <iostream>
+#include <string>
+#include <stdexcept>
+
+#include <utils/options/OptionsStaticSchema.h>
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef WANT_MEMCHECK
+#include <foreign/nvwa/debug_new.h>
+#endif // WANT_MEMCHECK
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * option definitions
+ * ======================================================================= */
+OPTIONS_STATIC_OPTION(Name, std::string, "name;n;user", "World");
+OPTIONS_STATIC_OPTION(Greet, std::string, "greet;g;salutation", "Hello");
+OPTIONS_STATIC_OPTION(Repeat, int, "repeat;r;times", 1);
+OPTIONS_STATIC_OPTION(Help, bool, "help;?", false);
+typedef OptionsStaticSchema<Name, Greet, Repeat, Help> ExampleOptions;
+
+
+
+/* =========================================================================
+ * enum definitions
+ * ======================================================================= */
+enum ReturnCodes {
+    STAT_OK = 0,
+    STAT_MISSING_OPTION = 1,
+    STAT_FALSE_OPTION = 2,
+    STAT_READ_COMMENT = 3
+};
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+int
+main(int argc, char *argv[]) {
+    ReturnCodes ret = STAT_OK;
+    try {
+        // parse options
+        ExampleOptions options;
+        options.parse(argc, argv);
+        // check for additional (meta) options
+        if(options.get<OPTIONS_KEY("help")>()) {
+            // print the help screen
+            std::cout << "Usage: static_example [option]+\n\nOptions:\n"
+                << "  -n, --name, --user        Defines how to call the user.\n"
+                << "  -g, --greet, --salutation Defines how to greet.\n"
+                << "  -r, --repeat, --times     Sets an optional number of repetitions.\n"
+                << "  -?, --help                Prints this help screen." << std::endl;
+        } else {
+            // do something; synonyms address the same option
+            const std::string &name = options.get<OPTIONS_KEY("name")>();
+            const std::string &greet = options.get<OPTIONS_KEY("salutation")>();
+            int number = options.get<OPTIONS_KEY("r")>();
+            for (int i=0; i<number; ++i) {
+                std::cout << greet << " " << name << "!" << std::endl;
+            }
+        }
+    } catch(std::runtime_error &e) {
+        cerr << e.what() << endl;
+        ret = STAT_READ_COMMENT;
+    }
+    if(ret!=STAT_OK) {
+        cerr << "Quitting (on error)." << endl;
+    }
+    return ret;
+}
+
+
+// *************************************************************************
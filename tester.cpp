@@ -43,14 +43,15 @@
 #include <iostream>
 #include <string>
 #include <cassert>
-#include <fstream>
-#include <sstream>
 
 #include <utils/options/OptionsCont.h>
 #include <utils/options/Option.h>
 #include <utils/options/OptionsIO.h>
 #include <utils/options/OptionsFileIO_CSV.h>
 #include <utils/options/OptionsFileIO_XML.h>
+#include <utils/options/OptionsFileIO_JSON.h>
+#include <utils/options/OptionsFileIO_INI.h>
+#include <utils/options/OptionsSchema.h>
 
 /* -------------------------------------------------------------------------
  * (optional) memory checking
@@ -81,6 +82,7 @@ using namespace std;
  * ======================================================================= */
 OptionsCont myOptions;
 std::string configOptionName;
+std::string envPrefix;
 OptionsTypedFileIO *fileIO = 0;
 
 
@@ -100,113 +102,24 @@ enum ReturnCodes {
 
 ReturnCodes
 loadDefinition() {
-    ifstream defs("options.txt");
-    if(!defs.good()) {
+    OptionsSchema schema;
+    if(!schema.read("options.txt")) {
         std::cerr << "Could not open the definitions file ('options.txt')" << std::endl;
         return STAT_MISSING_DEFINITION;
     }
-    while(defs.good()) {
-        string line;
-        std::getline(defs, line);
-        if(line.find(';')==string::npos) {
-            // ok, it's a subsection
-        } else {
-            // ok, it's an option
-            // ... parse the line
-            std::vector<std::string> synonyms;
-            char abbr = '!';
-            std::string type, description, defaultValue;
-            istringstream f(line);
-            string s;    
-            while (getline(f, s, ';')) {
-                if(type.length()==0) {
-                    type = s;
-                    continue;
-                }
-                if (s.length()==1) {
-                    abbr = s[0];
-                } else if(s[0]=='!') {
-                    description = s.substr(1);
-                }  else if(s[0]=='+') {
-                    defaultValue = s.substr(1);
-                } else {
-                    synonyms.push_back(s);
-                }
-            }
-            // ... is it the tail/head help stuff?
-            if(type=="HELPHEADTAIL") {
-                myOptions.setHelpHeadAndTail(synonyms[0], synonyms[1]);
-                continue;
-            }
-            if(type=="CONFIG") {
-                configOptionName = synonyms[0];
-                if(configOptionName.find("xml")!=std::string::npos) {
-                    fileIO = new OptionsFileIO_XML();
-                } else if(configOptionName.find("csv")!=std::string::npos) {
-                    fileIO = new OptionsFileIO_CSV();
-                } else {
-                    throw std::runtime_error("Unknown configuration format");
-                }
-
-                continue;
-            }
-            // ... is it a named section begin?
-            if(type=="SECTION") {
-                myOptions.beginSection(synonyms[0]);
-                continue;
-            }
-            // ... build the option, first
-            Option *option = 0;
-            if(type=="INT") {
-                if(defaultValue.length()==0) {
-                    option = new Option_Integer();
-                } else {
-                    int v = atoi(defaultValue.c_str());
-                    option = new Option_Integer(v);
-                }
-            } else if(type=="DOUBLE") {
-                if(defaultValue.length()==0) {
-                    option = new Option_Double();
-                } else {
-                    double v = atof(defaultValue.c_str());
-                    option = new Option_Double(v);
-                }
-            } else if(type=="BOOL") {
-                if(defaultValue.length()==0) {
-                    option = new Option_Bool();
-                } else {
-                    option = new Option_Bool();
-                }
-            } else if(type=="STRING") {
-                if(defaultValue.length()==0) {
-                    option = new Option_String();
-                } else {
-                    option = new Option_String(defaultValue);
-                }
-            } else if(type=="FILE") {
-                if(defaultValue.length()==0) {
-                    option = new Option_FileName();
-                } else {
-                    option = new Option_FileName(defaultValue);
-                }
-            }
-            // ... add it to the container
-            std::string firstName = synonyms.front();
-            synonyms.erase(synonyms.begin());
-            if(abbr!='!') {
-                myOptions.add(firstName, abbr, option);
-            } else {
-                myOptions.add(firstName, option);
-            }
-            while(!synonyms.empty()) {
-                myOptions.addSynonym(firstName, synonyms.front());
-                synonyms.erase(synonyms.begin());
-            }
-            // ... add description if given
-            if(description.length()!=0) {
-                myOptions.setDescription(firstName, description);
-            }
-        }
+    schema.fill(myOptions);
+    configOptionName = schema.getConfigOptionName();
+    envPrefix = schema.getEnvPrefix();
+    if(configOptionName.find("xml")!=std::string::npos) {
+        fileIO = new OptionsFileIO_XML();
+    } else if(configOptionName.find("csv")!=std::string::npos) {
+        fileIO = new OptionsFileIO_CSV();
+    } else if(configOptionName.find("json")!=std::string::npos) {
+        fileIO = new OptionsFileIO_JSON();
+    } else if(configOptionName.find("ini")!=std::string::npos) {
+        fileIO = new OptionsFileIO_INI();
+    } else if(configOptionName.length()!=0) {
+        throw std::runtime_error("Unknown configuration format");
     }
     return STAT_OK;
 }
@@ -215,11 +128,19 @@ int
 main(int argc, char *argv[]) {
     ReturnCodes ret = STAT_OK;
     // load the definition
-    ret = loadDefinition();
+    try {
+        ret = loadDefinition();
+    } catch(std::runtime_error &e) {
+        std::cerr << "Got std::runtime_error: " << e.what() << std::endl;
+        ret = STAT_MISSING_DEFINITION;
+    }
     // parse options
     if(ret==STAT_OK) {
         try {
-            if(!OptionsIO::parseAndLoad(myOptions, argc, argv, *fileIO, configOptionName)) {
+            bool ok = envPrefix.length()!=0
+                ? OptionsIO::parseAndLoad(myOptions, argc, argv, envPrefix, *fileIO, configOptionName)
+                : OptionsIO::parseAndLoad(myOptions, argc, argv, *fileIO, configOptionName);
+            if(!ok) {
                 ret = STAT_READ_COMMENT;
             }
             OptionsIO::printHelp(std::cout, myOptions);
@@ -0,0 +1,5 @@
+set TEXTTEST_HOME=%~dp0
+set STATIC_EXAMPLE_BINARY=%CD%\..\..\bin\static_example.exe
+SET TEXTTESTPY=texttest.exe
+start %TEXTTESTPY% -a static_example 
+
@@ -26,6 +26,9 @@
 #include <math.h>
 #include <limits.h>
 #include "Option.h"
+#include "OptionsHash.h"
+#include "OptionsConstraint.h"
+#include "OptionsFlags.h"
 
 /* -------------------------------------------------------------------------
  * (optional) memory checking
@@ -50,21 +53,22 @@ using namespace std;
  * Option-methods
  * ----------------------------------------------------------------------- */
 Option::Option(bool hasDefault)
-    : myAmSetable(true), myAmSet(hasDefault), myHaveDefaultValue(hasDefault) {
+    : myFlags((unsigned char) ((1<<OptionsFlags::FLAG_SETABLE) | (hasDefault ? (1<<OptionsFlags::FLAG_SET) | (1<<OptionsFlags::FLAG_DEFAULT) : 0))),
+      myContainerFlags(0), myID(0) {
 }
 
 
 Option::Option(const Option &s)
-    : myAmSetable(s.myAmSetable), myAmSet(s.myAmSet),
-      myHaveDefaultValue(s.myHaveDefaultValue) {
+    : myFlags(s.myFlags.load(std::memory_order_relaxed)), myContainerFlags(0), myID(0),
+      myConstraints(s.myConstraints) {
 }
 
 
 Option &Option::operator=(const Option &s) {
     if(&s==this) return *this;
-    myAmSetable = s.myAmSetable;
-    myAmSet = s.myAmSet;
-    myHaveDefaultValue = s.myHaveDefaultValue;
+    // the option stays attached to its container
+    setFlags(s.myFlags.load(std::memory_order_relaxed));
+    myConstraints = s.myConstraints;
     return *this;
 }
 
@@ -74,31 +78,77 @@ Option::~Option() {
 
 
 bool
-Option::isSet() {
-    return myAmSet;
+Option::isSet() const {
+    return (myFlags.load(std::memory_order_relaxed)&(1<<OptionsFlags::FLAG_SET))!=0;
 }
 
 
 bool
-Option::isDefault() {
-    return myHaveDefaultValue;
+Option::isDefault() const {
+    return (myFlags.load(std::memory_order_relaxed)&(1<<OptionsFlags::FLAG_DEFAULT))!=0;
 }
 
 
 void
 Option::remarkSetable() {
-    myAmSetable = true;
+    setFlags((unsigned char) (myFlags.load(std::memory_order_relaxed) | (1<<OptionsFlags::FLAG_SETABLE)));
 }
 
 
 void
 Option::setSet() {
-    if(myAmSetable==false) {
+    if(!canBeSet()) {
         throw std::runtime_error("This option was already set.");
     }
-    myAmSetable = false;
-    myHaveDefaultValue = false;
-    myAmSet = true;
+    setFlags((unsigned char) (1<<OptionsFlags::FLAG_SET));
+}
+
+
+void
+Option::setTuned() {
+    myFlags.fetch_and((unsigned char) ~(1<<OptionsFlags::FLAG_DEFAULT), std::memory_order_relaxed);
+    if(myContainerFlags!=0) {
+        myContainerFlags->clear(myID, OptionsFlags::FLAG_DEFAULT);
+    }
+}
+
+
+void
+Option::attach(OptionsFlags *flags, size_t id) {
+    myContainerFlags = flags;
+    myID = id;
+    flags->store(id, myFlags.load(std::memory_order_relaxed));
+}
+
+
+void
+Option::setFlags(unsigned char flags) {
+    myFlags.store(flags, std::memory_order_relaxed);
+    if(myContainerFlags!=0) {
+        myContainerFlags->store(myID, flags);
+    }
+}
+
+
+void
+Option::addConstraint(OptionsConstraint *constraint) {
+    myConstraints.push_back(std::shared_ptr<const OptionsConstraint>(constraint));
+}
+
+
+void
+Option::checkConstraints(double value) const {
+    for(std::vector<std::shared_ptr<const OptionsConstraint> >::const_iterator i=myConstraints.begin(); i!=myConstraints.end(); ++i) {
+        (*i)->check(value);
+    }
+}
+
+
+void
+Option::checkConstraints(const std::string &value) const {
+    for(std::vector<std::shared_ptr<const OptionsConstraint> >::const_iterator i=myConstraints.begin(); i!=myConstraints.end(); ++i) {
+        (*i)->check(value);
+    }
 }
 
 
@@ -127,9 +177,32 @@ Option::isFileName() const {
 }
 
 
+bool
+Option::isTunable() const {
+    return false;
+}
+
+
+Option::ValueKind
+Option::getValueKind() const {
+    return VALUE_STRING;
+}
+
+
+void
+Option::validate(const std::string &) const {
+}
+
+
+void
+Option::tune(const std::string &) {
+    throw std::runtime_error("This option is not tunable.");
+}
+
+
 bool
 Option::canBeSet() const {
-    return myAmSetable;
+    return (myFlags.load(std::memory_order_relaxed)&(1<<OptionsFlags::FLAG_SETABLE))!=0;
 }
 
 
@@ -166,16 +239,50 @@ Option_Integer::~Option_Integer() {
 }
 
 
+Option_Integer *
+Option_Integer::clone() const {
+    return new Option_Integer(*this);
+}
+
+
+void
+Option_Integer::restore(const Option &copy) {
+    *this = dynamic_cast<const Option_Integer&>(copy);
+}
+
+
 std::string
 Option_Integer::getTypeName() {
     return "int";
 }
 
 
+Option::ValueKind
+Option_Integer::getValueKind() const {
+    return VALUE_INTEGER;
+}
+
+
 void 
 Option_Integer::set(const std::string &value) {
-    myValue = parseInteger(value.c_str());
+    int parsed = parseInteger(value.c_str());
+    checkConstraints((double) parsed);
+    setSet();
+    myValue = parsed;
+}
+
+
+void
+Option_Integer::validate(const std::string &value) const {
+    checkConstraints((double) parseInteger(value.c_str()));
+}
+
+
+void
+Option_Integer::setValue(int value) {
+    checkConstraints((double) value);
     setSet();
+    myValue = value;
 }
 
 
@@ -244,33 +351,51 @@ Option_Bool::~Option_Bool() {
 }
 
 
+Option_Bool *
+Option_Bool::clone() const {
+    return new Option_Bool(*this);
+}
+
+
+void
+Option_Bool::restore(const Option &copy) {
+    *this = dynamic_cast<const Option_Bool&>(copy);
+}
+
+
 std::string
 Option_Bool::getTypeName() {
     return "bool";
 }
 
 
-void 
-Option_Bool::set(const std::string &v) {
-    std::string value = v;
-#if defined __BORLANDC__
-    // Borland does not know how to transform
-    for(size_t i=0; i<value.length(); ++i) {
-        if(value[i]>='A'&&value[i]<='Z') {
-            value[i] = value[i] - ('A'-'a');
-        }
-    }
-#else
-    std::transform(value.begin(), value.end(), value.begin(), ::tolower);
-#endif
-    if(value=="t"||value=="true"||value=="1") {
-        myValue = true;
-    } else if(value=="f"||value=="false"||value=="0") {
-        myValue = false;
-    } else {
-        throw std::runtime_error("value is not a bool");
-    }
+Option::ValueKind
+Option_Bool::getValueKind() const {
+    return VALUE_BOOL;
+}
+
+
+void
+Option_Bool::set(const std::string &value) {
+    bool parsed = parseBool(value);
+    // constraints check the normalised text ("true" or "false")
+    checkConstraints(parsed ? "true" : "false");
+    setSet();
+    myValue = parsed;
+}
+
+
+void
+Option_Bool::validate(const std::string &value) const {
+    checkConstraints(parseBool(value) ? "true" : "false");
+}
+
+
+void
+Option_Bool::setValue(bool value) {
+    checkConstraints(value ? "true" : "false");
     setSet();
+    myValue = value;
 }
 
 
@@ -290,6 +415,28 @@ Option_Bool::getValueAsString() const {
 }
 
 
+bool
+Option_Bool::parseBool(const std::string &data) {
+    std::string value = data;
+#if defined __BORLANDC__
+    // Borland does not know how to transform
+    for(size_t i=0; i<value.length(); ++i) {
+        if(value[i]>='A'&&value[i]<='Z') {
+            value[i] = value[i] - ('A'-'a');
+        }
+    }
+#else
+    std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+#endif
+    if(value=="t"||value=="true"||value=="1") {
+        return true;
+    } else if(value=="f"||value=="false"||value=="0") {
+        return false;
+    }
+    throw std::runtime_error("value is not a bool");
+}
+
+
 
 
 /* -------------------------------------------------------------------------
@@ -324,16 +471,50 @@ Option_Double::~Option_Double() {
 }
 
 
+Option_Double *
+Option_Double::clone() const {
+    return new Option_Double(*this);
+}
+
+
+void
+Option_Double::restore(const Option &copy) {
+    *this = dynamic_cast<const Option_Double&>(copy);
+}
+
+
 std::string
 Option_Double::getTypeName() {
     return "double";
 }
 
 
+Option::ValueKind
+Option_Double::getValueKind() const {
+    return VALUE_REAL;
+}
+
+
 void 
 Option_Double::set(const std::string &value) {
-    myValue = parseDouble(value.c_str());
+    double parsed = parseDouble(value.c_str());
+    checkConstraints(parsed);
+    setSet();
+    myValue = parsed;
+}
+
+
+void
+Option_Double::validate(const std::string &value) const {
+    checkConstraints(parseDouble(value.c_str()));
+}
+
+
+void
+Option_Double::setValue(double value) {
+    checkConstraints(value);
     setSet();
+    myValue = value;
 }
 
 
@@ -447,6 +628,18 @@ Option_String::~Option_String() {
 }
 
 
+Option_String *
+Option_String::clone() const {
+    return new Option_String(*this);
+}
+
+
+void
+Option_String::restore(const Option &copy) {
+    *this = dynamic_cast<const Option_String&>(copy);
+}
+
+
 std::string
 Option_String::getTypeName() {
     return "string";
@@ -455,11 +648,26 @@ Option_String::getTypeName() {
 
 void 
 Option_String::set(const std::string &value) {
+    checkConstraints(value);
     setSet();
     myValue = value;
 }
 
 
+void
+Option_String::setValue(const char *data, size_t length) {
+    checkConstraints(std::string(data, length));
+    setSet();
+    myValue.assign(data, length);
+}
+
+
+void
+Option_String::validate(const std::string &value) const {
+    checkConstraints(value);
+}
+
+
 const std::string &
 Option_String::getValue() const {
     return myValue;
@@ -504,6 +712,12 @@ Option_FileName::~Option_FileName() {
 }
 
 
+Option_FileName *
+Option_FileName::clone() const {
+    return new Option_FileName(*this);
+}
+
+
 
 bool
 Option_FileName::isFileName() const {
@@ -518,4 +732,643 @@ Option_FileName::getTypeName() {
 
 
 
+
+/* -------------------------------------------------------------------------
+ * Option_BoundInteger-methods
+ * ----------------------------------------------------------------------- */
+Option_BoundInteger::Option_BoundInteger(int &variable)
+    : Option_Integer(), myVariable(&variable) {
+}
+
+
+Option_BoundInteger::Option_BoundInteger(int &variable, int value)
+    : Option_Integer(value), myVariable(&variable) {
+    *myVariable = value;
+}
+
+
+Option_BoundInteger::Option_BoundInteger(const Option_BoundInteger &s)
+    : Option_Integer(s), myVariable(s.myVariable) {
+}
+
+
+Option_BoundInteger &
+Option_BoundInteger::operator=(const Option_BoundInteger &s) {
+    if(&s==this) return *this;
+    Option_Integer::operator=(s);
+    myVariable = s.myVariable;
+    return *this;
+}
+
+
+Option_BoundInteger::~Option_BoundInteger() {
+}
+
+
+Option_Integer *
+Option_BoundInteger::clone() const {
+    return new Option_Integer(*this);
+}
+
+
+void
+Option_BoundInteger::restore(const Option &copy) {
+    Option_Integer::restore(copy);
+    if(isSet()) {
+        *myVariable = getValue();
+    }
+}
+
+
+void
+Option_BoundInteger::set(const std::string &value) {
+    Option_Integer::set(value);
+    *myVariable = getValue();
+}
+
+
+void
+Option_BoundInteger::setValue(int value) {
+    Option_Integer::setValue(value);
+    *myVariable = value;
+}
+
+
+
+
+/* -------------------------------------------------------------------------
+ * Option_BoundBool-methods
+ * ----------------------------------------------------------------------- */
+Option_BoundBool::Option_BoundBool(bool &variable)
+    : Option_Bool(), myVariable(&variable) {
+    *myVariable = getValue();
+}
+
+
+Option_BoundBool::Option_BoundBool(const Option_BoundBool &s)
+    : Option_Bool(s), myVariable(s.myVariable) {
+}
+
+
+Option_BoundBool &
+Option_BoundBool::operator=(const Option_BoundBool &s) {
+    if(&s==this) return *this;
+    Option_Bool::operator=(s);
+    myVariable = s.myVariable;
+    return *this;
+}
+
+
+Option_BoundBool::~Option_BoundBool() {
+}
+
+
+Option_Bool *
+Option_BoundBool::clone() const {
+    return new Option_Bool(*this);
+}
+
+
+void
+Option_BoundBool::restore(const Option &copy) {
+    Option_Bool::restore(copy);
+    if(isSet()) {
+        *myVariable = getValue();
+    }
+}
+
+
+void
+Option_BoundBool::set(const std::string &value) {
+    Option_Bool::set(value);
+    *myVariable = getValue();
+}
+
+
+void
+Option_BoundBool::setValue(bool value) {
+    Option_Bool::setValue(value);
+    *myVariable = value;
+}
+
+
+
+
+/* -------------------------------------------------------------------------
+ * Option_BoundDouble-methods
+ * ----------------------------------------------------------------------- */
+Option_BoundDouble::Option_BoundDouble(double &variable)
+    : Option_Double(), myVariable(&variable) {
+}
+
+
+Option_BoundDouble::Option_BoundDouble(double &variable, double value)
+    : Option_Double(value), myVariable(&variable) {
+    *myVariable = value;
+}
+
+
+Option_BoundDouble::Option_BoundDouble(const Option_BoundDouble &s)
+    : Option_Double(s), myVariable(s.myVariable) {
+}
+
+
+Option_BoundDouble &
+Option_BoundDouble::operator=(const Option_BoundDouble &s) {
+    if(&s==this) return *this;
+    Option_Double::operator=(s);
+    myVariable = s.myVariable;
+    return *this;
+}
+
+
+Option_BoundDouble::~Option_BoundDouble() {
+}
+
+
+Option_Double *
+Option_BoundDouble::clone() const {
+    return new Option_Double(*this);
+}
+
+
+void
+Option_BoundDouble::restore(const Option &copy) {
+    Option_Double::restore(copy);
+    if(isSet()) {
+        *myVariable = getValue();
+    }
+}
+
+
+void
+Option_BoundDouble::set(const std::string &value) {
+    Option_Double::set(value);
+    *myVariable = getValue();
+}
+
+
+void
+Option_BoundDouble::setValue(double value) {
+    Option_Double::setValue(value);
+    *myVariable = value;
+}
+
+
+
+
+/* -------------------------------------------------------------------------
+ * Option_BoundString-methods
+ * ----------------------------------------------------------------------- */
+Option_BoundString::Option_BoundString(std::string &variable)
+    : Option_String(), myVariable(&variable) {
+}
+
+
+Option_BoundString::Option_BoundString(std::string &variable, const std::string &value)
+    : Option_String(value), myVariable(&variable) {
+    *myVariable = value;
+}
+
+
+Option_BoundString::Option_BoundString(const Option_BoundString &s)
+    : Option_String(s), myVariable(s.myVariable) {
+}
+
+
+Option_BoundString &
+Option_BoundString::operator=(const Option_BoundString &s) {
+    if(&s==this) return *this;
+    Option_String::operator=(s);
+    myVariable = s.myVariable;
+    return *this;
+}
+
+
+Option_BoundString::~Option_BoundString() {
+}
+
+
+Option_String *
+Option_BoundString::clone() const {
+    return new Option_String(*this);
+}
+
+
+void
+Option_BoundString::restore(const Option &copy) {
+    Option_String::restore(copy);
+    if(isSet()) {
+        *myVariable = getValue();
+    }
+}
+
+
+void
+Option_BoundString::set(const std::string &value) {
+    Option_String::set(value);
+    *myVariable = getValue();
+}
+
+
+void
+Option_BoundString::setValue(const char *data, size_t length) {
+    Option_String::setValue(data, length);
+    *myVariable = getValue();
+}
+
+
+
+
+/* -------------------------------------------------------------------------
+ * Option_Enum-methods
+ * ----------------------------------------------------------------------- */
+Option_Enum::Option_Enum(const std::vector<std::string> &choices)
+    : Option(), myChoices(choices), myValue(-1) {
+    buildTable();
+}
+
+
+Option_Enum::Option_Enum(const std::vector<std::string> &choices, const std::string &value)
+    : Option(true), myChoices(choices), myValue(-1) {
+    buildTable();
+    myValue = getCode(value);
+}
+
+
+Option_Enum::Option_Enum(const Option_Enum &s)
+    : Option(s), myChoices(s.myChoices), mySlots(s.mySlots), myValue(s.myValue) {
+}
+
+
+Option_Enum &
+Option_Enum::operator=(const Option_Enum &s) {
+    if(&s==this) return *this;
+    Option::operator=(s);
+    myChoices = s.myChoices;
+    mySlots = s.mySlots;
+    myValue = s.myValue;
+    return *this;
+}
+
+
+Option_Enum::~Option_Enum() {
+}
+
+
+Option_Enum *
+Option_Enum::clone() const {
+    return new Option_Enum(*this);
+}
+
+
+void
+Option_Enum::restore(const Option &copy) {
+    *this = dynamic_cast<const Option_Enum&>(copy);
+}
+
+
+std::string
+Option_Enum::getTypeName() {
+    return "enum";
+}
+
+
+void
+Option_Enum::set(const std::string &value) {
+    int code = getCode(value);
+    checkConstraints(value);
+    setSet();
+    myValue = code;
+}
+
+
+void
+Option_Enum::setValue(int value) {
+    if(value<0 || value>=(int) myChoices.size()) {
+        throw std::runtime_error("value is not a code of the choices");
+    }
+    checkConstraints(myChoices[value]);
+    setSet();
+    myValue = value;
+}
+
+
+void
+Option_Enum::validate(const std::string &value) const {
+    getCode(value);
+    checkConstraints(value);
+}
+
+
+int
+Option_Enum::getValue() const {
+    return myValue;
+}
+
+
+std::string
+Option_Enum::getValueAsString() const {
+    return myValue<0 ? "" : myChoices[myValue];
+}
+
+
+const std::vector<std::string> &
+Option_Enum::getChoices() const {
+    return myChoices;
+}
+
+
+int
+Option_Enum::getCode(const std::string &value) const {
+    int code = find(value.data(), value.length());
+    if(code>=0) {
+        return code;
+    }
+    std::string message = "value '" + value + "' is not one of ";
+    for(std::vector<std::string>::const_iterator i=myChoices.begin(); i!=myChoices.end(); ++i) {
+        message += (i!=myChoices.begin() ? ", '" : "'") + *i + "'";
+    }
+    std::string suggestion = getSuggestion(value);
+    if(suggestion!="") {
+        message += "; did you mean '" + suggestion + "'?";
+    }
+    throw std::runtime_error(message);
+}
+
+
+void
+Option_Enum::buildTable() {
+    if(myChoices.empty() || myChoices.size()>=65535) {
+        throw std::runtime_error("an enum option needs between 1 and 65534 choices");
+    }
+    std::vector<unsigned long long> hashes;
+    for(std::vector<std::string>::iterator i=myChoices.begin(); i!=myChoices.end(); ++i) {
+        if(std::find(myChoices.begin(), i, *i)!=i) {
+            throw std::runtime_error("choice '" + *i + "' is given twice");
+        }
+        hashes.push_back(OptionsHash::fnv1a(*i));
+    }
+    // use the smallest table size the hashes are mapped onto distinct slots for
+    const size_t number = myChoices.size();
+    for(size_t size=number; size<4*number*number+8; ++size) {
+        mySlots.assign(size, 0);
+        size_t i = 0;
+        for(; i<number && mySlots[hashes[i]%size]==0; ++i) {
+            mySlots[hashes[i]%size] = (unsigned short) (i+1);
+        }
+        if(i==number) {
+            return;
+        }
+    }
+    // no perfect table (only if hashes collide); find() falls back to comparing all choices
+    mySlots.clear();
+}
+
+
+int
+Option_Enum::find(const char *data, size_t length) const {
+    if(mySlots.empty()) {
+        for(size_t i=0; i<myChoices.size(); ++i) {
+            if(myChoices[i].length()==length && myChoices[i].compare(0, length, data, length)==0) {
+                return (int) i;
+            }
+        }
+        return -1;
+    }
+    const unsigned short slot = mySlots[OptionsHash::fnv1a(data, length)%mySlots.size()];
+    if(slot==0 || myChoices[slot-1].length()!=length || myChoices[slot-1].compare(0, length, data, length)!=0) {
+        return -1;
+    }
+    return slot - 1;
+}
+
+
+std::string
+Option_Enum::getSuggestion(const std::string &value) const {
+    // the choice with the smallest edit distance, if it differs in at most a third of its characters
+    std::string best;
+    size_t bestDistance = 0;
+    std::vector<size_t> previous, current;
+    for(std::vector<std::string>::const_iterator i=myChoices.begin(); i!=myChoices.end(); ++i) {
+        const std::string &choice = *i;
+        previous.resize(choice.length()+1);
+        current.resize(choice.length()+1);
+        for(size_t k=0; k<=choice.length(); ++k) {
+            previous[k] = k;
+        }
+        for(size_t j=1; j<=value.length(); ++j) {
+            current[0] = j;
+            for(size_t k=1; k<=choice.length(); ++k) {
+                size_t substitution = previous[k-1] + (tolower(value[j-1])==tolower(choice[k-1]) ? 0 : 1);
+                current[k] = std::min(substitution, std::min(previous[k], current[k-1]) + 1);
+            }
+            previous.swap(current);
+        }
+        size_t distance = previous[choice.length()];
+        if(distance<=(choice.length()+2)/3 && (best=="" || distance<bestDistance)) {
+            best = choice;
+            bestDistance = distance;
+        }
+    }
+    return best;
+}
+
+
+
+
+/* -------------------------------------------------------------------------
+ * Option_TunableInteger-methods
+ * ----------------------------------------------------------------------- */
+Option_TunableInteger::Option_TunableInteger(int value)
+    : Option(true), myValue(value) {
+}
+
+
+Option_TunableInteger::Option_TunableInteger(const Option_TunableInteger &s)
+    : Option(s), myValue(s.getValue()) {
+}
+
+
+Option_TunableInteger &
+Option_TunableInteger::operator=(const Option_TunableInteger &s) {
+    if(&s==this) return *this;
+    Option::operator=(s);
+    myValue.store(s.getValue(), std::memory_order_relaxed);
+    return *this;
+}
+
+
+Option_TunableInteger::~Option_TunableInteger() {
+}
+
+
+Option_TunableInteger *
+Option_TunableInteger::clone() const {
+    return new Option_TunableInteger(*this);
+}
+
+
+void
+Option_TunableInteger::restore(const Option &copy) {
+    *this = dynamic_cast<const Option_TunableInteger&>(copy);
+}
+
+
+std::string
+Option_TunableInteger::getTypeName() {
+    return "int";
+}
+
+
+Option::ValueKind
+Option_TunableInteger::getValueKind() const {
+    return VALUE_INTEGER;
+}
+
+
+bool
+Option_TunableInteger::isTunable() const {
+    return true;
+}
+
+
+void
+Option_TunableInteger::set(const std::string &value) {
+    int parsed = Option_Integer::parseInteger(value.c_str());
+    checkConstraints((double) parsed);
+    setSet();
+    myValue.store(parsed, std::memory_order_relaxed);
+}
+
+
+void
+Option_TunableInteger::tune(const std::string &value) {
+    int parsed = Option_Integer::parseInteger(value.c_str());
+    checkConstraints((double) parsed);
+    myValue.store(parsed, std::memory_order_relaxed);
+    setTuned();
+}
+
+
+void
+Option_TunableInteger::validate(const std::string &value) const {
+    checkConstraints((double) Option_Integer::parseInteger(value.c_str()));
+}
+
+
+void
+Option_TunableInteger::setValue(int value) {
+    checkConstraints((double) value);
+    setSet();
+    myValue.store(value, std::memory_order_relaxed);
+}
+
+
+std::string
+Option_TunableInteger::getValueAsString() const {
+    std::ostringstream oss;
+    oss << getValue();
+    return oss.str();
+}
+
+
+
+
+/* -------------------------------------------------------------------------
+ * Option_TunableDouble-methods
+ * ----------------------------------------------------------------------- */
+Option_TunableDouble::Option_TunableDouble(double value)
+    : Option(true), myValue(value) {
+}
+
+
+Option_TunableDouble::Option_TunableDouble(const Option_TunableDouble &s)
+    : Option(s), myValue(s.getValue()) {
+}
+
+
+Option_TunableDouble &
+Option_TunableDouble::operator=(const Option_TunableDouble &s) {
+    if(&s==this) return *this;
+    Option::operator=(s);
+    myValue.store(s.getValue(), std::memory_order_relaxed);
+    return *this;
+}
+
+
+Option_TunableDouble::~Option_TunableDouble() {
+}
+
+
+Option_TunableDouble *
+Option_TunableDouble::clone() const {
+    return new Option_TunableDouble(*this);
+}
+
+
+void
+Option_TunableDouble::restore(const Option &copy) {
+    *this = dynamic_cast<const Option_TunableDouble&>(copy);
+}
+
+
+std::string
+Option_TunableDouble::getTypeName() {
+    return "double";
+}
+
+
+Option::ValueKind
+Option_TunableDouble::getValueKind() const {
+    return VALUE_REAL;
+}
+
+
+bool
+Option_TunableDouble::isTunable() const {
+    return true;
+}
+
+
+void
+Option_TunableDouble::set(const std::string &value) {
+    double parsed = Option_Double::parseDouble(value.c_str());
+    checkConstraints(parsed);
+    setSet();
+    myValue.store(parsed, std::memory_order_relaxed);
+}
+
+
+void
+Option_TunableDouble::tune(const std::string &value) {
+    double parsed = Option_Double::parseDouble(value.c_str());
+    checkConstraints(parsed);
+    myValue.store(parsed, std::memory_order_relaxed);
+    setTuned();
+}
+
+
+void
+Option_TunableDouble::validate(const std::string &value) const {
+    checkConstraints(Option_Double::parseDouble(value.c_str()));
+}
+
+
+void
+Option_TunableDouble::setValue(double value) {
+    checkConstraints(value);
+    setSet();
+    myValue.store(value, std::memory_order_relaxed);
+}
+
+
+std::string
+Option_TunableDouble::getValueAsString() const {
+    std::ostringstream oss;
+    oss << getValue();
+    return oss.str();
+}
+
+
 // *************************************************************************
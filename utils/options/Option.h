@@ -23,6 +23,9 @@
  * included modules
  * ======================================================================= */
 #include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
 
 /* -------------------------------------------------------------------
  * (optional) memory checking
@@ -33,6 +36,24 @@
 
 
 
+/* =========================================================================
+ * definitions
+ * ======================================================================= */
+/// @brief The assumed size of a cache line; tunable values are padded by it
+#ifndef OPTIONS_CACHE_LINE_SIZE
+#define OPTIONS_CACHE_LINE_SIZE 64
+#endif
+
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class OptionsConstraint;
+class OptionsFlags;
+
+
+
 /* =========================================================================
  * class definitions
  * ======================================================================= */
@@ -47,26 +68,61 @@
  * Still, the class is not an abstract class. Type-checking for the set
  *  options is done using methods from TypedValue and throwing exceptions
  *  rather than type-checking of the option during runtime.
+ *
+ * The option's state (whether it may be set, is set, has its default value)
+ *  is kept as flags which are written through to the flags of the container
+ *  the option was added to (see OptionsFlags); copies are not attached to
+ *  a container.
  */
 class Option {
 public:
+    /// @brief The kinds of values, used where a value is written with its kind (e.g. JSON)
+    enum ValueKind {
+        /// @brief A string (or a value of a type without a more specific kind)
+        VALUE_STRING,
+        /// @brief An integer number
+        VALUE_INTEGER,
+        /// @brief A real number
+        VALUE_REAL,
+        /// @brief A bool
+        VALUE_BOOL
+    };
+
+
     /// @brief Destructor
     virtual ~Option();
 
 
+    /** @brief Returns a copy of this option
+     *
+     * Pure virtual, this method has to be implemented by the respective type-aware subclasses
+     * @return A new option of the same type and with the same state
+     */
+    virtual Option *clone() const = 0;
+
+
+    /** @brief Sets the value and the state of this option to the ones of the given copy
+     *
+     * Used to undo changes. Pure virtual, this method has to be implemented
+     *  by the respective type-aware subclasses
+     * @param[in] copy A copy of this option, made using clone()
+     */
+    virtual void restore(const Option &copy) = 0;
+
+
     /** @brief Returns whether this option's value may be read
      *
      * The option's value may be read if either a default value was
      *  given or the user supplied a value.
 	 * @return Whether the option has been set
      */
-    bool isSet();
+    bool isSet() const;
 
 
     /** @brief Returns whether this option's value is the default value
-	* @return Whether the option has the defaulot value
+	* @return Whether the option has the default value (neither set nor tuned)
 	*/
-    bool isDefault();
+    bool isDefault() const;
 
 
     /** @brief Allows setting this option
@@ -94,6 +150,32 @@ public:
     virtual bool isFileName() const;
 
 
+    /** @brief Returns whether this option may be changed at runtime (see tune())
+     *
+     * Returns false unless overridden (in Option_TunableInteger and Option_TunableDouble)
+	 * @return Whether this option is tunable
+	 */
+    virtual bool isTunable() const;
+
+
+    /** @brief Returns the kind of the option's value
+     *
+     * Returns VALUE_STRING unless overridden
+	 * @return The kind of this option's value
+	 */
+    virtual ValueKind getValueKind() const;
+
+
+    /** @brief Changes the value of a tunable option at runtime
+     *
+     * Other than set(), this method may be called repeatedly and concurrently
+     *  to reading the value.
+     * @param[in] value The value to set
+     * @throw runtime_error If the option is not tunable or the value cannot be parsed
+	 */
+    virtual void tune(const std::string &value);
+
+
     /** @brief Sets the current value to the given
      *
      * Pure virtual, this method has to be implemented by the respective type-aware subclasses
@@ -104,6 +186,24 @@ public:
     virtual void set(const std::string &value) = 0;
 
 
+    /** @brief Checks whether the given value could be set
+     *
+     * Does not change the option. Accepts every value unless overridden.
+     * @param[in] value The value to check
+     * @throw runtime_error If the value is not valid for this option
+	 */
+    virtual void validate(const std::string &value) const;
+
+
+    /** @brief Adds a constraint the option's values must fulfil
+     *
+     * The constraint is checked when a value is set or validated; copies of
+     *  the option share it.
+     * @param[in] constraint The constraint to add (the option takes ownership)
+	 */
+    void addConstraint(OptionsConstraint *constraint);
+
+
     /** @brief Adds a description (what appears in the help screen) to the option
      *
      * @param[in] desc The description to set
@@ -144,10 +244,10 @@ protected:
     /** @brief constructor
      *
      * Use this constructor to build an option with a given type and no default value
-     * Sets:
-     * @arg myAmSetable to true
-     * @arg myAmSet to false
-     * @arg myHaveDefaultValue to hasDefault
+     * Sets the flags:
+     * @arg setable to true
+     * @arg set to hasDefault
+     * @arg default to hasDefault
      *
      * @param[in] hasDefault Whether a default values has been supplied
      */
@@ -169,23 +269,55 @@ protected:
 
     /** @brief checks and marks further usage of this option on setting it
      *
-     * Checks whether this option may be set using myAmSetable.
+     * Checks whether this option may be set using the setable flag.
      * If not, throws an InvalidArgument-exception.
-     * If yes, sets myAmSetable to false, myAmSet to true and myHaveDefaultValue to false
+     * If yes, clears the setable and the default flag and sets the set flag
      */
     void setSet();
 
 
+    /// @brief Marks the value as changed at runtime (see tune()), clearing the default flag
+    void setTuned();
+
+
+    /** @brief Checks the given number using the option's constraints
+     * @param[in] value The (parsed) value to check
+     * @throw runtime_error If a constraint is violated
+     */
+    void checkConstraints(double value) const;
+
+
+    /** @brief Checks the given string using the option's constraints
+     * @param[in] value The value to check
+     * @throw runtime_error If a constraint is violated
+     */
+    void checkConstraints(const std::string &value) const;
+
+
+
+private:
+    /** @brief Attaches the option to the flags of the container it is added to
+     * @param[in] flags The container's flags
+     * @param[in] id The option's ID within the container
+     */
+    void attach(OptionsFlags *flags, size_t id);
+
+
+    /** @brief Replaces the flags, writing them through to the container's flags
+     * @param[in] flags The new flags, a bit per set OptionsFlags::Flag
+     */
+    void setFlags(unsigned char flags);
+
 
 private:
-    /// @brief Information whether a new value can be assigned
-    bool myAmSetable;
+    /// @brief Whether a new value can be assigned, the value may be read, and it is the default (see OptionsFlags::Flag)
+    std::atomic<unsigned char> myFlags;
 
-    /// @brief Information whether this option's value may be read
-    bool myAmSet;
+    /// @brief The flags of the container the option was added to, 0 if none
+    OptionsFlags *myContainerFlags;
 
-    /// @brief Information whether this option's value is the one given optionally at initialisation
-    bool myHaveDefaultValue;
+    /// @brief The option's ID within the container
+    size_t myID;
 
     /// @brief The description (what appears in the help screen) of the option
     std::string myDescription;
@@ -193,6 +325,12 @@ private:
     /// @brief The semantic type of the option
     std::string mySemanticType;
 
+    /// @brief The constraints the values must fulfil
+    std::vector<std::shared_ptr<const OptionsConstraint> > myConstraints;
+
+
+    friend class OptionsCont;
+
 
 };
 
@@ -231,12 +369,30 @@ public:
     ~Option_Integer();
 
 
+    /** @brief Returns a copy of this option
+     * @return A new option of the same type and with the same state
+     */
+    Option_Integer *clone() const;
+
+
+    /** @brief Sets the value and the state of this option to the ones of the given copy
+     * @param[in] copy A copy of this option, made using clone()
+     */
+    void restore(const Option &copy);
+
+
     /** @brief Returns the name of the type this option has
 	 * @return This option's value's type name
 	 */
     std::string getTypeName();
 
 
+    /** @brief Returns the kind of the option's value
+	 * @return The kind of this option's value (VALUE_INTEGER)
+	 */
+    ValueKind getValueKind() const;
+
+
     /** @brief Sets the current value to the given
      * @param[in] value The value to set
      * @throw InvalidArgument if this option already has been set (see setSet())
@@ -245,6 +401,20 @@ public:
     void set(const std::string &value);
 
 
+    /** @brief Sets the current value to the given one without parsing
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+	 */
+    virtual void setValue(int value);
+
+
+    /** @brief Checks whether the given value could be set
+     * @param[in] value The value to check
+     * @throw runtime_error If the value is not an integer
+	 */
+    void validate(const std::string &value) const;
+
+
     /** @brief Returns the integer value
      * @return The option's value
      */
@@ -280,6 +450,9 @@ private:
 /**
  * @class Option_Bool
  * @brief A derivation of Option which accepts boolean values.
+ *
+ * Constraints (see addConstraint) are checked using the normalised text
+ *  of the value, "true" or "false".
  */
 class Option_Bool : public Option {
 public:
@@ -307,12 +480,30 @@ public:
     ~Option_Bool();
 
 
+    /** @brief Returns a copy of this option
+     * @return A new option of the same type and with the same state
+     */
+    Option_Bool *clone() const;
+
+
+    /** @brief Sets the value and the state of this option to the ones of the given copy
+     * @param[in] copy A copy of this option, made using clone()
+     */
+    void restore(const Option &copy);
+
+
     /** @brief Returns the name of the type this option has
 	 * @return This option's value's type name
 	 */
     std::string getTypeName();
 
 
+    /** @brief Returns the kind of the option's value
+	 * @return The kind of this option's value (VALUE_BOOL)
+	 */
+    ValueKind getValueKind() const;
+
+
     /** @brief Sets the current value to the given
      * @param[in] value The value to set
      * @throw InvalidArgument if this option already has been set (see setSet())
@@ -321,6 +512,20 @@ public:
     void set(const std::string &value);
 
 
+    /** @brief Sets the current value to the given one without parsing
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+	 */
+    virtual void setValue(bool value);
+
+
+    /** @brief Checks whether the given value could be set
+     * @param[in] value The value to check
+     * @throw runtime_error If the value is not a bool
+	 */
+    void validate(const std::string &value) const;
+
+
     /** @brief Returns the boolean value
      * @return The option's value
      */
@@ -335,6 +540,14 @@ public:
     std::string getValueAsString() const;
 
 
+    /** Parses the given string assuming it contains a bool
+     * @param[in] data The string to parse ("t", "true", "1", "f", "false", "0", case-insensitive)
+     * @return the parsed bool
+     * @throw runtime_error If the string could not been parsed to a bool
+     */
+    static bool parseBool(const std::string &data);
+
+
 
 private:
     /// @brief The boolean value (if set)
@@ -378,12 +591,30 @@ public:
     ~Option_Double();
 
 
+    /** @brief Returns a copy of this option
+     * @return A new option of the same type and with the same state
+     */
+    Option_Double *clone() const;
+
+
+    /** @brief Sets the value and the state of this option to the ones of the given copy
+     * @param[in] copy A copy of this option, made using clone()
+     */
+    void restore(const Option &copy);
+
+
     /** @brief Returns the name of the type this option has
 	 * @return This option's value's type name
 	 */
     std::string getTypeName();
 
 
+    /** @brief Returns the kind of the option's value
+	 * @return The kind of this option's value (VALUE_REAL)
+	 */
+    ValueKind getValueKind() const;
+
+
     /** @brief Sets the current value to the given
      * @param[in] value The value to set
      * @throw InvalidArgument if this option already has been set (see setSet())
@@ -392,6 +623,20 @@ public:
     void set(const std::string &value);
 
 
+    /** @brief Sets the current value to the given one without parsing
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+	 */
+    virtual void setValue(double value);
+
+
+    /** @brief Checks whether the given value could be set
+     * @param[in] value The value to check
+     * @throw runtime_error If the value is not a double
+	 */
+    void validate(const std::string &value) const;
+
+
     /** @brief Returns the double value
      * @return The option's value
      */
@@ -457,6 +702,18 @@ public:
     ~Option_String();
 
 
+    /** @brief Returns a copy of this option
+     * @return A new option of the same type and with the same state
+     */
+    Option_String *clone() const;
+
+
+    /** @brief Sets the value and the state of this option to the ones of the given copy
+     * @param[in] copy A copy of this option, made using clone()
+     */
+    void restore(const Option &copy);
+
+
     /** @brief Returns the name of the type this option has
 	 * @return This option's value's type name
 	 */
@@ -471,6 +728,23 @@ public:
     void set(const std::string &value);
 
 
+    /** @brief Sets the current value to the given characters
+     *
+     * The characters are copied into the already allocated storage if it is large enough.
+     * @param[in] data The characters to set
+     * @param[in] length The number of characters
+     * @throw InvalidArgument if this option already has been set (see setSet())
+	 */
+    virtual void setValue(const char *data, size_t length);
+
+
+    /** @brief Checks whether the given value could be set
+     * @param[in] value The value to check
+     * @throw runtime_error If the value violates a constraint
+	 */
+    void validate(const std::string &value) const;
+
+
     /** @brief Returns the string value
      * @return The option's value
      */
@@ -528,6 +802,12 @@ public:
     ~Option_FileName();
 
 
+    /** @brief Returns a copy of this option
+     * @return A new option of the same type and with the same state
+     */
+    Option_FileName *clone() const;
+
+
     /** @brief Returns whether this option is of the type "filename"
      * This overriding version returns always true
 	 * @return Whether this is option stores a filename (true)
@@ -545,5 +825,733 @@ public:
 
 
 
-// *************************************************************************
-#endif
+
+/**
+ * @class Option_BoundInteger
+ * @brief A derivation of Option_Integer which writes its value into a variable of the application
+ *
+ * Each time the option is set, the parsed value is written into the bound
+ *  variable, so that the application can read the variable directly. The
+ *  variable must outlive the option.
+ *
+ * Copies (clone()) are plain Option_Integer options which are not bound, so that
+ *  overriding a value (e.g. in an OptionsOverlay) does not change the variable.
+ */
+class Option_BoundInteger : public Option_Integer {
+public:
+    /** @brief Constructor to use if no default is given
+     *
+     * The variable is not changed until the option is set.
+	 * @param[in] variable The variable to write the value into
+	 */
+    Option_BoundInteger(int &variable);
+
+
+    /** @brief Constructor to use if a default shall be set
+     *
+     * The default is written into the variable.
+	 * @param[in] variable The variable to write the value into
+	 * @param[in] value The default value
+	 */
+    Option_BoundInteger(int &variable, int value);
+
+
+    /** @brief Copying constructor
+     *
+     * The copy is bound to the same variable.
+	 * @param[in] s The option to copy
+	 */
+    Option_BoundInteger(const Option_BoundInteger &s);
+
+
+    /** @brief Assignment operator
+	 * @param[in] s The option to copy
+     * @return A reference to this instance
+     */
+    Option_BoundInteger &operator=(const Option_BoundInteger &s);
+
+
+    /// @brief Destructor
+    ~Option_BoundInteger();
+
+
+    /** @brief Returns an unbound copy of this option
+     * @return A new, unbound option of the base type and with the same state
+     */
+    Option_Integer *clone() const;
+
+
+    /** @brief Sets the value and the state of this option to the ones of the given copy and writes the value into the variable
+     * @param[in] copy A copy of this option, made using clone()
+     */
+    void restore(const Option &copy);
+
+
+    /** @brief Sets the current value to the given and writes it into the variable
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+     * @throw runtime_error if it is not an integer
+	 */
+    void set(const std::string &value);
+
+
+    /** @brief Sets the current value to the given one without parsing and writes it into the variable
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+	 */
+    void setValue(int value);
+
+
+
+private:
+    /// @brief The variable the value is written into
+    int *myVariable;
+
+
+};
+
+
+
+/**
+ * @class Option_BoundBool
+ * @brief A derivation of Option_Bool which writes its value into a variable of the application
+ *
+ * Each time the option is set, the parsed value is written into the bound
+ *  variable, so that the application can read the variable directly. The
+ *  variable must outlive the option.
+ *
+ * Copies (clone()) are plain Option_Bool options which are not bound, so that
+ *  overriding a value (e.g. in an OptionsOverlay) does not change the variable.
+ */
+class Option_BoundBool : public Option_Bool {
+public:
+    /** @brief Constructor
+     *
+     * As for all boolean options, the default is false; it is written into the variable.
+	 * @param[in] variable The variable to write the value into
+	 */
+    Option_BoundBool(bool &variable);
+
+
+    /** @brief Copying constructor
+     *
+     * The copy is bound to the same variable.
+	 * @param[in] s The option to copy
+	 */
+    Option_BoundBool(const Option_BoundBool &s);
+
+
+    /** @brief Assignment operator
+	 * @param[in] s The option to copy
+     * @return A reference to this instance
+     */
+    Option_BoundBool &operator=(const Option_BoundBool &s);
+
+
+    /// @brief Destructor
+    ~Option_BoundBool();
+
+
+    /** @brief Returns an unbound copy of this option
+     * @return A new, unbound option of the base type and with the same state
+     */
+    Option_Bool *clone() const;
+
+
+    /** @brief Sets the value and the state of this option to the ones of the given copy and writes the value into the variable
+     * @param[in] copy A copy of this option, made using clone()
+     */
+    void restore(const Option &copy);
+
+
+    /** @brief Sets the current value to the given and writes it into the variable
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+     * @throw runtime_error if it is not a bool
+	 */
+    void set(const std::string &value);
+
+
+    /** @brief Sets the current value to the given one without parsing and writes it into the variable
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+	 */
+    void setValue(bool value);
+
+
+
+private:
+    /// @brief The variable the value is written into
+    bool *myVariable;
+
+
+};
+
+
+
+/**
+ * @class Option_BoundDouble
+ * @brief A derivation of Option_Double which writes its value into a variable of the application
+ *
+ * Each time the option is set, the parsed value is written into the bound
+ *  variable, so that the application can read the variable directly. The
+ *  variable must outlive the option.
+ *
+ * Copies (clone()) are plain Option_Double options which are not bound, so that
+ *  overriding a value (e.g. in an OptionsOverlay) does not change the variable.
+ */
+class Option_BoundDouble : public Option_Double {
+public:
+    /** @brief Constructor to use if no default is given
+     *
+     * The variable is not changed until the option is set.
+	 * @param[in] variable The variable to write the value into
+	 */
+    Option_BoundDouble(double &variable);
+
+
+    /** @brief Constructor to use if a default shall be set
+     *
+     * The default is written into the variable.
+	 * @param[in] variable The variable to write the value into
+	 * @param[in] value The default value
+	 */
+    Option_BoundDouble(double &variable, double value);
+
+
+    /** @brief Copying constructor
+     *
+     * The copy is bound to the same variable.
+	 * @param[in] s The option to copy
+	 */
+    Option_BoundDouble(const Option_BoundDouble &s);
+
+
+    /** @brief Assignment operator
+	 * @param[in] s The option to copy
+     * @return A reference to this instance
+     */
+    Option_BoundDouble &operator=(const Option_BoundDouble &s);
+
+
+    /// @brief Destructor
+    ~Option_BoundDouble();
+
+
+    /** @brief Returns an unbound copy of this option
+     * @return A new, unbound option of the base type and with the same state
+     */
+    Option_Double *clone() const;
+
+
+    /** @brief Sets the value and the state of this option to the ones of the given copy and writes the value into the variable
+     * @param[in] copy A copy of this option, made using clone()
+     */
+    void restore(const Option &copy);
+
+
+    /** @brief Sets the current value to the given and writes it into the variable
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+     * @throw runtime_error if it is not a double
+	 */
+    void set(const std::string &value);
+
+
+    /** @brief Sets the current value to the given one without parsing and writes it into the variable
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+	 */
+    void setValue(double value);
+
+
+
+private:
+    /// @brief The variable the value is written into
+    double *myVariable;
+
+
+};
+
+
+
+/**
+ * @class Option_BoundString
+ * @brief A derivation of Option_String which writes its value into a variable of the application
+ *
+ * Each time the option is set, the value is written into the bound
+ *  variable, so that the application can read the variable directly. The
+ *  variable must outlive the option.
+ *
+ * Copies (clone()) are plain Option_String options which are not bound, so that
+ *  overriding a value (e.g. in an OptionsOverlay) does not change the variable.
+ */
+class Option_BoundString : public Option_String {
+public:
+    /** @brief Constructor to use if no default is given
+     *
+     * The variable is not changed until the option is set.
+	 * @param[in] variable The variable to write the value into
+	 */
+    Option_BoundString(std::string &variable);
+
+
+    /** @brief Constructor to use if a default shall be set
+     *
+     * The default is written into the variable.
+	 * @param[in] variable The variable to write the value into
+	 * @param[in] value The default value
+	 */
+    Option_BoundString(std::string &variable, const std::string &value);
+
+
+    /** @brief Copying constructor
+     *
+     * The copy is bound to the same variable.
+	 * @param[in] s The option to copy
+	 */
+    Option_BoundString(const Option_BoundString &s);
+
+
+    /** @brief Assignment operator
+	 * @param[in] s The option to copy
+     * @return A reference to this instance
+     */
+    Option_BoundString &operator=(const Option_BoundString &s);
+
+
+    /// @brief Destructor
+    ~Option_BoundString();
+
+
+    /** @brief Returns an unbound copy of this option
+     * @return A new, unbound option of the base type and with the same state
+     */
+    Option_String *clone() const;
+
+
+    /** @brief Sets the value and the state of this option to the ones of the given copy and writes the value into the variable
+     * @param[in] copy A copy of this option, made using clone()
+     */
+    void restore(const Option &copy);
+
+
+    /** @brief Sets the current value to the given and writes it into the variable
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+	 */
+    void set(const std::string &value);
+
+
+    /** @brief Sets the current value to the given characters and writes it into the variable
+     * @param[in] data The characters to set
+     * @param[in] length The number of characters
+     * @throw InvalidArgument if this option already has been set (see setSet())
+	 */
+    void setValue(const char *data, size_t length);
+
+
+
+private:
+    /// @brief The variable the value is written into
+    std::string *myVariable;
+
+
+};
+
+
+/**
+ * @class Option_Enum
+ * @brief A derivation of Option which accepts one of a set of literals
+ *
+ * The allowed literals ("choices") are given when the option is built; each
+ *  is represented by its index within the choices ("code"). When the option is
+ *  set, the literal is mapped onto its code using a perfect hash table built
+ *  in the constructor, so that reading the value is reading an int.
+ * @code
+ * myOptions.add("mode", new Option_Enum({"fast", "safe"}, "safe"));
+ * switch(myOptions.getEnum("mode")) { ... }
+ * @endcode
+ */
+class Option_Enum : public Option {
+public:
+    /** @brief Constructor to use if no default is given
+	 * @param[in] choices The allowed literals
+     * @throw runtime_error If a literal is given twice
+	 */
+    Option_Enum(const std::vector<std::string> &choices);
+
+
+    /** @brief Constructor to use if a default shall be set
+	 * @param[in] choices The allowed literals
+	 * @param[in] value The default literal
+     * @throw runtime_error If a literal is given twice or the default is not one of them
+	 */
+    Option_Enum(const std::vector<std::string> &choices, const std::string &value);
+
+
+    /** @brief Copying constructor
+	 * @param[in] s The option to copy
+	 */
+    Option_Enum(const Option_Enum &s);
+
+
+    /** @brief Assignment operator
+	 * @param[in] s The option to copy
+     * @return A reference to this instance
+     */
+    Option_Enum &operator=(const Option_Enum &s);
+
+
+    /// @brief Destructor
+    ~Option_Enum();
+
+
+    /** @brief Returns a copy of this option
+     * @return A new option of the same type and with the same state
+     */
+    Option_Enum *clone() const;
+
+
+    /** @brief Sets the value and the state of this option to the ones of the given copy
+     * @param[in] copy A copy of this option, made using clone()
+     */
+    void restore(const Option &copy);
+
+
+    /** @brief Returns the name of the type this option has
+	 * @return This option's value's type name
+	 */
+    std::string getTypeName();
+
+
+    /** @brief Sets the current value to the given literal
+     * @param[in] value The literal to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+     * @throw runtime_error if it is not one of the choices
+	 */
+    void set(const std::string &value);
+
+
+    /** @brief Sets the current value to the given code
+     * @param[in] value The code to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+     * @throw runtime_error if it is not the code of a choice
+	 */
+    void setValue(int value);
+
+
+    /** @brief Checks whether the given value could be set
+     * @param[in] value The value to check
+     * @throw runtime_error If the value is not one of the choices
+	 */
+    void validate(const std::string &value) const;
+
+
+    /** @brief Returns the code of the value
+     * @return The index of the option's value within the choices
+     */
+    int getValue() const;
+
+
+    /** @brief Returns the value (if set) as a string
+     * @return The literal, if set
+	 */
+    std::string getValueAsString() const;
+
+
+    /** @brief Returns the allowed literals
+     * @return The choices, ordered by their codes
+	 */
+    const std::vector<std::string> &getChoices() const;
+
+
+    /** @brief Returns the code of the given literal
+     * @param[in] value The literal
+     * @return The literal's code
+     * @throw runtime_error If the literal is not one of the choices (naming the most similar one)
+	 */
+    int getCode(const std::string &value) const;
+
+
+
+private:
+    /// @brief Builds the perfect hash table over the choices
+    void buildTable();
+
+
+    /** @brief Returns the code of the given literal
+     * @param[in] data The literal's characters
+     * @param[in] length The number of characters
+     * @return The literal's code, -1 if it is not one of the choices
+	 */
+    int find(const char *data, size_t length) const;
+
+
+    /** @brief Returns the choice that is most similar to the given literal
+     * @param[in] value The literal
+     * @return The most similar choice, "" if none is similar
+	 */
+    std::string getSuggestion(const std::string &value) const;
+
+
+
+private:
+    /// @brief The allowed literals
+    std::vector<std::string> myChoices;
+
+    /// @brief The perfect hash table: the code (+1) stored in each slot, 0 for empty slots
+    std::vector<unsigned short> mySlots;
+
+    /// @brief The code of the value (if set)
+    int myValue;
+
+
+};
+
+
+
+
+/**
+ * @class Option_TunableInteger
+ * @brief An integer option that may be changed at runtime
+ *
+ * The value is stored in an atomic which is padded to lie on a cache line
+ *  of its own. Reading it is a relaxed load; tune() changes it without
+ *  locking and without the set-once rule.
+ *
+ * Tunable options need a default value, so they are always set.
+ */
+class Option_TunableInteger : public Option {
+public:
+    /** @brief Constructor
+	 * @param[in] value The default value
+	 */
+    Option_TunableInteger(int value);
+
+
+    /** @brief Copying constructor
+	 * @param[in] s The option to copy
+	 */
+    Option_TunableInteger(const Option_TunableInteger &s);
+
+
+    /** @brief Assignment operator
+	 * @param[in] s The option to copy
+     * @return A reference to this instance
+     */
+    Option_TunableInteger &operator=(const Option_TunableInteger &s);
+
+
+    /// @brief Destructor
+    ~Option_TunableInteger();
+
+
+    /** @brief Returns a copy of this option
+     * @return A new option of the same type and with the same state
+     */
+    Option_TunableInteger *clone() const;
+
+
+    /** @brief Sets the value and the state of this option to the ones of the given copy
+     * @param[in] copy A copy of this option, made using clone()
+     */
+    void restore(const Option &copy);
+
+
+    /** @brief Returns the name of the type this option has
+	 * @return This option's value's type name
+	 */
+    std::string getTypeName();
+
+
+    /** @brief Returns the kind of the option's value
+	 * @return The kind of this option's value (VALUE_INTEGER)
+	 */
+    ValueKind getValueKind() const;
+
+
+    /** @brief Returns whether this option is tunable
+	 * @return Whether this option is tunable (true)
+	 */
+    bool isTunable() const;
+
+
+    /** @brief Sets the current value to the given
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+     * @throw runtime_error if it is not an integer
+	 */
+    void set(const std::string &value);
+
+
+    /** @brief Sets the current value to the given one without parsing
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+	 */
+    void setValue(int value);
+
+
+    /** @brief Changes the value at runtime
+     * @param[in] value The value to set
+     * @throw runtime_error if it is not an integer
+	 */
+    void tune(const std::string &value);
+
+
+    /** @brief Checks whether the given value could be set
+     * @param[in] value The value to check
+     * @throw runtime_error If the value is not an integer
+	 */
+    void validate(const std::string &value) const;
+
+
+    /** @brief Returns the integer value
+     * @return The option's value
+     */
+    int getValue() const {
+        return myValue.load(std::memory_order_relaxed);
+    }
+
+
+    /** @brief Returns the value as a string
+     * @return The value as a string
+	 */
+    std::string getValueAsString() const;
+
+
+
+private:
+    /// @brief Padding separating the value from data stored before
+    char myPaddingBefore[OPTIONS_CACHE_LINE_SIZE];
+
+    /// @brief The integer value
+    std::atomic<int> myValue;
+
+    /// @brief Padding separating the value from data stored behind
+    char myPaddingBehind[OPTIONS_CACHE_LINE_SIZE];
+
+
+};
+
+
+
+/**
+ * @class Option_TunableDouble
+ * @brief A double option that may be changed at runtime
+ * @see Option_TunableInteger
+ */
+class Option_TunableDouble : public Option {
+public:
+    /** @brief Constructor
+	 * @param[in] value The default value
+	 */
+    Option_TunableDouble(double value);
+
+
+    /** @brief Copying constructor
+	 * @param[in] s The option to copy
+	 */
+    Option_TunableDouble(const Option_TunableDouble &s);
+
+
+    /** @brief Assignment operator
+	 * @param[in] s The option to copy
+     * @return A reference to this instance
+     */
+    Option_TunableDouble &operator=(const Option_TunableDouble &s);
+
+
+    /// @brief Destructor
+    ~Option_TunableDouble();
+
+
+    /** @brief Returns a copy of this option
+     * @return A new option of the same type and with the same state
+     */
+    Option_TunableDouble *clone() const;
+
+
+    /** @brief Sets the value and the state of this option to the ones of the given copy
+     * @param[in] copy A copy of this option, made using clone()
+     */
+    void restore(const Option &copy);
+
+
+    /** @brief Returns the name of the type this option has
+	 * @return This option's value's type name
+	 */
+    std::string getTypeName();
+
+
+    /** @brief Returns the kind of the option's value
+	 * @return The kind of this option's value (VALUE_REAL)
+	 */
+    ValueKind getValueKind() const;
+
+
+    /** @brief Returns whether this option is tunable
+	 * @return Whether this option is tunable (true)
+	 */
+    bool isTunable() const;
+
+
+    /** @brief Sets the current value to the given
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+     * @throw runtime_error if it is not a double
+	 */
+    void set(const std::string &value);
+
+
+    /** @brief Sets the current value to the given one without parsing
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+	 */
+    void setValue(double value);
+
+
+    /** @brief Changes the value at runtime
+     * @param[in] value The value to set
+     * @throw runtime_error if it is not a double
+	 */
+    void tune(const std::string &value);
+
+
+    /** @brief Checks whether the given value could be set
+     * @param[in] value The value to check
+     * @throw runtime_error If the value is not a double
+	 */
+    void validate(const std::string &value) const;
+
+
+    /** @brief Returns the double value
+     * @return The option's value
+     */
+    double getValue() const {
+        return myValue.load(std::memory_order_relaxed);
+    }
+
+
+    /** @brief Returns the value as a string
+     * @return The value as a string
+	 */
+    std::string getValueAsString() const;
+
+
+
+private:
+    /// @brief Padding separating the value from data stored before
+    char myPaddingBefore[OPTIONS_CACHE_LINE_SIZE];
+
+    /// @brief The double value
+    std::atomic<double> myValue;
+
+    /// @brief Padding separating the value from data stored behind
+    char myPaddingBehind[OPTIONS_CACHE_LINE_SIZE];
+
+
+};
+
+// *************************************************************************
+#endif
\ No newline at end of file
@@ -0,0 +1,442 @@
+#ifndef OptionTyped_h
+#define OptionTyped_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionTyped.h
+   @since        19.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <climits>
+#include <stdexcept>
+#include <type_traits>
+#include "Option.h"
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @struct OptionsConverter
+ * @brief Converts option values of the given type from and to strings
+ *
+ * Specialise this template (or write an own converter and give it to
+ *  Option_Typed) to add a type. A converter has three static methods:
+ * @code
+ * struct DurationConverter {
+ *     static const char *getTypeName() { return "duration"; }
+ *     // parses length characters (not necessarily 0-terminated), throws a runtime_error if they are not valid
+ *     static void parse(const char *data, size_t length, Duration &into);
+ *     // writes the value into the buffer, returns the length it needs (as snprintf)
+ *     static size_t format(const Duration &value, char *buffer, size_t size);
+ * };
+ * @endcode
+ *
+ * Specialisations for int, long long, double, bool and std::string are given.
+ */
+template<typename T> struct OptionsConverter;
+
+
+/**
+ * @class OptionsConverterBuffer
+ * @brief Makes a 0-terminated copy of characters, on the stack if they are short
+ */
+class OptionsConverterBuffer {
+public:
+    /** @brief Constructor
+     * @param[in] data The characters to copy
+     * @param[in] length The number of characters
+     */
+    OptionsConverterBuffer(const char *data, size_t length)
+        : myData(length<sizeof(myBuffer) ? myBuffer : 0) {
+        if(myData==0) {
+            myLong.assign(data, data+length);
+            myLong.push_back(0);
+            myData = &myLong[0];
+        } else {
+            memcpy(myBuffer, data, length);
+            myBuffer[length] = 0;
+        }
+    }
+
+
+    /** @brief Returns the 0-terminated copy
+     * @return The copied characters
+     */
+    const char *get() const {
+        return myData;
+    }
+
+
+private:
+    /// @brief The storage used for short values
+    char myBuffer[64];
+
+    /// @brief The storage used for long values
+    std::vector<char> myLong;
+
+    /// @brief The copy
+    char *myData;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsConverterBuffer(const OptionsConverterBuffer &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsConverterBuffer &operator=(const OptionsConverterBuffer &s);
+
+
+};
+
+
+/// @brief Converts int values
+template<> struct OptionsConverter<int> {
+    static const char *getTypeName() {
+        return "int";
+    }
+
+    static void parse(const char *data, size_t length, int &into) {
+        into = Option_Integer::parseInteger(OptionsConverterBuffer(data, length).get());
+    }
+
+    static size_t format(const int &value, char *buffer, size_t size) {
+        return (size_t) snprintf(buffer, size, "%d", value);
+    }
+};
+
+
+/// @brief Converts long long values
+template<> struct OptionsConverter<long long> {
+    static const char *getTypeName() {
+        return "long";
+    }
+
+    static void parse(const char *data, size_t length, long long &into) {
+        OptionsConverterBuffer buffer(data, length);
+        char *end;
+        errno = 0;
+        into = strtoll(buffer.get(), &end, 0);
+        if(length==0 || *end!=0 || errno==ERANGE) {
+            throw std::runtime_error("value is not a long");
+        }
+    }
+
+    static size_t format(const long long &value, char *buffer, size_t size) {
+        return (size_t) snprintf(buffer, size, "%lld", value);
+    }
+};
+
+
+/// @brief Converts double values
+template<> struct OptionsConverter<double> {
+    static const char *getTypeName() {
+        return "double";
+    }
+
+    static void parse(const char *data, size_t length, double &into) {
+        into = Option_Double::parseDouble(OptionsConverterBuffer(data, length).get());
+    }
+
+    static size_t format(const double &value, char *buffer, size_t size) {
+        // "%g" matches the default formatting of streams used by Option_Double
+        return (size_t) snprintf(buffer, size, "%g", value);
+    }
+};
+
+
+/// @brief Converts bool values ("t", "true", "1", "f", "false", "0", case-insensitive)
+template<> struct OptionsConverter<bool> {
+    static const char *getTypeName() {
+        return "bool";
+    }
+
+    static void parse(const char *data, size_t length, bool &into) {
+        if(equals(data, length, "t") || equals(data, length, "true") || equals(data, length, "1")) {
+            into = true;
+        } else if(equals(data, length, "f") || equals(data, length, "false") || equals(data, length, "0")) {
+            into = false;
+        } else {
+            throw std::runtime_error("value is not a bool");
+        }
+    }
+
+    static size_t format(const bool &value, char *buffer, size_t size) {
+        return (size_t) snprintf(buffer, size, "%s", value ? "true" : "false");
+    }
+
+    /// @brief Returns whether the characters equal the given lower-case literal, ignoring case
+    static bool equals(const char *data, size_t length, const char *literal) {
+        for(size_t i=0; i<length; ++i, ++literal) {
+            char c = data[i]>='A' && data[i]<='Z' ? (char) (data[i] - ('A'-'a')) : data[i];
+            if(*literal==0 || c!=*literal) {
+                return false;
+            }
+        }
+        return *literal==0;
+    }
+};
+
+
+/// @brief Converts string values
+template<> struct OptionsConverter<std::string> {
+    static const char *getTypeName() {
+        return "string";
+    }
+
+    static void parse(const char *data, size_t length, std::string &into) {
+        into.assign(data, length);
+    }
+
+    static size_t format(const std::string &value, char *buffer, size_t size) {
+        if(value.length()<size) {
+            memcpy(buffer, value.data(), value.length());
+            buffer[value.length()] = 0;
+        }
+        return value.length();
+    }
+};
+
+
+
+/**
+ * @class Option_TypedValue
+ * @brief The value of a typed option, independent of the converter
+ *
+ * Typed options are read through this class, e.g. using
+ *  OptionsCont::get<T> or OptionsHandle<Option_TypedValue<T>, const T &>.
+ */
+template<typename T>
+class Option_TypedValue : public Option {
+public:
+    /// @brief Destructor
+    ~Option_TypedValue() { }
+
+
+    /** @brief Returns the value
+     * @return The option's value
+     */
+    const T &getValue() const {
+        return myValue;
+    }
+
+
+protected:
+    /** @brief Constructor to use if no default is given
+     */
+    Option_TypedValue()
+        : Option(), myValue() {
+    }
+
+
+    /** @brief Constructor to use if a default shall be set
+	 * @param[in] value The default value
+	 */
+    Option_TypedValue(const T &value)
+        : Option(true), myValue(value) {
+    }
+
+
+protected:
+    /// @brief The value (if set)
+    T myValue;
+
+
+};
+
+
+
+/**
+ * @class Option_Typed
+ * @brief An option of the given type, converted from and to strings using the given converter
+ *
+ * The value is parsed once, when the option is set, and stored with its type.
+ *  Neither parsing nor formatting uses streams or allocates memory (but for
+ *  the values themselves, e.g. strings, and for formatting very long values).
+ * @code
+ * myOptions.add("timeout", new Option_Typed<Duration, DurationConverter>(Duration(30)));
+ * const Duration &timeout = myOptions.get<Duration>("timeout");
+ * @endcode
+ */
+template<typename T, class Converter=OptionsConverter<T> >
+class Option_Typed : public Option_TypedValue<T> {
+public:
+    /// @brief Constructor to use if no default is given
+    Option_Typed()
+        : Option_TypedValue<T>() {
+    }
+
+
+    /** @brief Constructor to use if a default shall be set
+	 * @param[in] value The default value
+	 */
+    Option_Typed(const T &value)
+        : Option_TypedValue<T>(value) {
+    }
+
+
+    /// @brief Destructor
+    ~Option_Typed() { }
+
+
+    /** @brief Returns a copy of this option
+     * @return A new option of the same type and with the same state
+     */
+    Option_Typed *clone() const {
+        return new Option_Typed(*this);
+    }
+
+
+    /** @brief Sets the value and the state of this option to the ones of the given copy
+     * @param[in] copy A copy of this option, made using clone()
+     */
+    void restore(const Option &copy) {
+        *this = dynamic_cast<const Option_Typed&>(copy);
+    }
+
+
+    /** @brief Returns the name of the type this option has
+	 * @return This option's value's type name
+	 */
+    std::string getTypeName() {
+        return Converter::getTypeName();
+    }
+
+
+    /** @brief Returns the kind of the option's value
+     *
+     * Numbers and bools converted using the default converter are reported
+     *  as such; values of other types or converters are strings.
+	 * @return The kind of this option's value
+	 */
+    Option::ValueKind getValueKind() const {
+        if(!std::is_same<Converter, OptionsConverter<T> >::value) {
+            return Option::VALUE_STRING;
+        }
+        if(std::is_same<T, bool>::value) {
+            return Option::VALUE_BOOL;
+        }
+        if(std::is_integral<T>::value) {
+            return Option::VALUE_INTEGER;
+        }
+        return std::is_floating_point<T>::value ? Option::VALUE_REAL : Option::VALUE_STRING;
+    }
+
+
+    /** @brief Sets the current value to the given
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+     * @throw runtime_error if the converter cannot parse the value
+	 */
+    void set(const std::string &value) {
+        T parsed;
+        Converter::parse(value.data(), value.length(), parsed);
+        checkParsed(value, parsed, IsNumber());
+        this->setSet();
+        this->myValue = parsed;
+    }
+
+
+    /** @brief Sets the current value to the given one without parsing
+     *
+     * Constraints are checked for numbers only; values of other types are
+     *  checked using the text (see set()).
+     * @param[in] value The value to set
+     * @throw InvalidArgument if this option already has been set (see setSet())
+     * @throw runtime_error If the value is a number violating a constraint
+	 */
+    void setValue(const T &value) {
+        checkNumber(value, IsNumber());
+        this->setSet();
+        this->myValue = value;
+    }
+
+
+    /** @brief Checks whether the given value could be set
+     * @param[in] value The value to check
+     * @throw runtime_error If the converter cannot parse the value
+	 */
+    void validate(const std::string &value) const {
+        T parsed;
+        Converter::parse(value.data(), value.length(), parsed);
+        checkParsed(value, parsed, IsNumber());
+    }
+
+
+    /** @brief Returns the value (if set) as a string
+     * @return The value as a string, if set
+	 */
+    std::string getValueAsString() const {
+        char buffer[64];
+        size_t length = Converter::format(this->myValue, buffer, sizeof(buffer));
+        if(length<sizeof(buffer)) {
+            return std::string(buffer, length);
+        }
+        std::vector<char> longBuffer(length+1);
+        Converter::format(this->myValue, &longBuffer[0], longBuffer.size());
+        return std::string(&longBuffer[0], length);
+    }
+
+
+private:
+    /// @brief Whether the values are numbers, checked by numeric constraints (bools are checked as text, as by Option_Bool)
+    typedef std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value> IsNumber;
+
+
+    /// @brief Checks a number using the parsed value
+    void checkParsed(const std::string &, const T &parsed, std::true_type) const {
+        this->checkConstraints((double) parsed);
+    }
+
+
+    /// @brief Checks other values using their text
+    void checkParsed(const std::string &value, const T &, std::false_type) const {
+        this->checkConstraints(value);
+    }
+
+
+    /// @brief Checks a number
+    void checkNumber(const T &value, std::true_type) const {
+        this->checkConstraints((double) value);
+    }
+
+
+    /// @brief Values of other types are not checked without their text
+    void checkNumber(const T &, std::false_type) const {
+    }
+
+
+};
+
+
+// *************************************************************************
+#endif
@@ -0,0 +1,86 @@
+#ifndef OptionsBatchScope_h
+#define OptionsBatchScope_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsBatchScope.h
+   @since        19.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include "OptionsCont.h"
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsBatchScope
+ * @brief Batches the change notifications of the options while existing
+ *
+ * Calls OptionsCont::beginBatch when built and OptionsCont::endBatch when
+ *  left, also if the scope is left by an exception.
+ * @code
+ * {
+ *     OptionsBatchScope batch(myOptions);
+ *     myOptions.tune("threads", "8");
+ *     myOptions.tune("timeout", "2.5");
+ * } // subscribers are informed about both changes at once
+ * @endcode
+ */
+class OptionsBatchScope {
+public:
+    /** @brief Constructor
+     * @param[in] options The options being changed
+     */
+    OptionsBatchScope(OptionsCont &options) : myOptions(options) {
+        myOptions.beginBatch();
+    }
+
+
+    /// @brief Destructor, delivers the changes
+    ~OptionsBatchScope() {
+        myOptions.endBatch();
+    }
+
+
+private:
+    /// @brief The options being changed
+    OptionsCont &myOptions;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsBatchScope(const OptionsBatchScope &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsBatchScope &operator=(const OptionsBatchScope &s);
+
+
+};
+
+
+// *************************************************************************
+#endif
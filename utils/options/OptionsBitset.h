@@ -0,0 +1,209 @@
+#ifndef OptionsBitset_h
+#define OptionsBitset_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsBitset.h
+   @since        19.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <vector>
+#include <cstddef>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsBitset
+ * @brief A dense, growable set of bits indexed by option ID
+ *
+ * The bits are stored in 64 bit words; counting uses popcount and
+ *  iterating uses find-first-set where the compiler offers them.
+ */
+class OptionsBitset {
+public:
+    /// @brief The number of bits per word
+    static const size_t WORD_BITS = 64;
+
+
+    /** @brief Constructor
+     * @param[in] size The number of bits, all cleared
+     */
+    OptionsBitset(size_t size=0)
+        : mySize(0) {
+        resize(size);
+    }
+
+
+    /** @brief Changes the number of bits; added bits are cleared
+     * @param[in] size The new number of bits
+     */
+    void resize(size_t size) {
+        myWords.resize((size+WORD_BITS-1)/WORD_BITS, 0);
+        mySize = size;
+        if(size%WORD_BITS!=0) {
+            // keep the unused bits of the last word cleared
+            myWords.back() &= (1ULL<<(size%WORD_BITS)) - 1;
+        }
+    }
+
+
+    /** @brief Returns the number of bits
+     * @return The number of bits
+     */
+    size_t size() const {
+        return mySize;
+    }
+
+
+    /** @brief Sets or clears a bit
+     * @param[in] index The index of the bit
+     * @param[in] value Whether the bit shall be set
+     */
+    void set(size_t index, bool value=true) {
+        if(value) {
+            myWords[index/WORD_BITS] |= 1ULL<<(index%WORD_BITS);
+        } else {
+            myWords[index/WORD_BITS] &= ~(1ULL<<(index%WORD_BITS));
+        }
+    }
+
+
+    /** @brief Returns whether a bit is set
+     * @param[in] index The index of the bit
+     * @return Whether the bit is set
+     */
+    bool test(size_t index) const {
+        return (myWords[index/WORD_BITS] & (1ULL<<(index%WORD_BITS)))!=0;
+    }
+
+
+    /// @brief Clears all bits
+    void clear() {
+        for(std::vector<unsigned long long>::iterator i=myWords.begin(); i!=myWords.end(); ++i) {
+            *i = 0;
+        }
+    }
+
+
+    /** @brief Returns the number of set bits
+     * @return The number of set bits
+     */
+    size_t count() const {
+        size_t ret = 0;
+        for(std::vector<unsigned long long>::const_iterator i=myWords.begin(); i!=myWords.end(); ++i) {
+            ret += popcount(*i);
+        }
+        return ret;
+    }
+
+
+    /** @brief Returns the index of the first set bit at or behind the given one
+     * @param[in] from The index to start at
+     * @return The index of the set bit, size() if there is none
+     */
+    size_t findNext(size_t from) const {
+        if(from>=mySize) {
+            return mySize;
+        }
+        size_t word = from/WORD_BITS;
+        unsigned long long bits = myWords[word] & (~0ULL<<(from%WORD_BITS));
+        while(bits==0) {
+            if(++word==myWords.size()) {
+                return mySize;
+            }
+            bits = myWords[word];
+        }
+        return word*WORD_BITS + findFirstSet(bits);
+    }
+
+
+    /** @brief Returns the word at the given index
+     * @param[in] index The index of the word
+     * @return The word
+     */
+    unsigned long long getWord(size_t index) const {
+        return myWords[index];
+    }
+
+
+    /** @brief Replaces the word at the given index
+     * @param[in] index The index of the word
+     * @param[in] word The new word; bits behind size() must be cleared
+     */
+    void setWord(size_t index, unsigned long long word) {
+        myWords[index] = word;
+    }
+
+
+    /** @brief Returns the number of set bits in a word
+     * @param[in] word The word
+     * @return The number of set bits
+     */
+    static size_t popcount(unsigned long long word) {
+#if defined __GNUC__
+        return (size_t) __builtin_popcountll(word);
+#else
+        size_t ret = 0;
+        for(; word!=0; word&=word-1) {
+            ++ret;
+        }
+        return ret;
+#endif
+    }
+
+
+    /** @brief Returns the index of the lowest set bit of a word
+     * @param[in] word The word, not 0
+     * @return The index of the lowest set bit
+     */
+    static size_t findFirstSet(unsigned long long word) {
+#if defined __GNUC__
+        return (size_t) __builtin_ctzll(word);
+#else
+        size_t ret = 0;
+        for(; (word&1)==0; word>>=1) {
+            ++ret;
+        }
+        return ret;
+#endif
+    }
+
+
+private:
+    /// @brief The bits
+    std::vector<unsigned long long> myWords;
+
+    /// @brief The number of bits
+    size_t mySize;
+
+
+};
+
+
+// *************************************************************************
+#endif
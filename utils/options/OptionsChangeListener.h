@@ -0,0 +1,68 @@
+#ifndef OptionsChangeListener_h
+#define OptionsChangeListener_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsChangeListener.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <vector>
+#include <cstddef>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class OptionsCont;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsChangeListener
+ * @brief Interface for classes that shall be informed about changed options
+ */
+class OptionsChangeListener {
+public:
+    /// @brief Destructor
+    virtual ~OptionsChangeListener() { }
+
+
+    /** @brief Called after options have changed
+     * @param[in] options The options container that holds the changed options
+     * @param[in] changed The IDs of the changed options (see OptionsCont::getOptionID)
+     */
+    virtual void optionsChanged(const OptionsCont &options, const std::vector<size_t> &changed) = 0;
+
+
+};
+
+
+// *************************************************************************
+#endif
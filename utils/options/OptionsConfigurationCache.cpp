@@ -0,0 +1,157 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsConfigurationCache.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <cstdlib>
+#include <climits>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "OptionsParsedConfiguration.h"
+#include "OptionsConfigurationCache.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * static helper definitions
+ * ======================================================================= */
+/**
+ * @struct CacheEntry
+ * @brief A cached configuration together with the state of its file
+ */
+struct CacheEntry {
+    /// @brief The file's modification time in nanoseconds
+    long long mtime;
+    /// @brief The file's size
+    long long size;
+    /// @brief The parsed configuration
+    std::shared_ptr<const OptionsParsedConfiguration> parsed;
+};
+
+
+/** @brief Returns the lock guarding the cache
+ * @return The cache's mutex
+ */
+static std::mutex &
+getCacheMutex() {
+    static std::mutex m;
+    return m;
+}
+
+
+/** @brief Returns the cache (reader + '\\n' + canonical path -> entry)
+ * @return The cache
+ */
+static std::map<std::string, CacheEntry> &
+getCache() {
+    static std::map<std::string, CacheEntry> c;
+    return c;
+}
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+bool
+OptionsConfigurationCache::getFileKey(const std::string &fileName, FileKey &key) {
+#if defined _MSC_VER || defined __BORLANDC__
+    struct _stat64 st;
+    if(_stat64(fileName.c_str(), &st)!=0) {
+        return false;
+    }
+    char buf[_MAX_PATH];
+    key.path = _fullpath(buf, fileName.c_str(), _MAX_PATH)!=0 ? buf : fileName;
+    key.mtime = (long long) st.st_mtime * 1000000000LL;
+#else
+    struct stat st;
+    if(stat(fileName.c_str(), &st)!=0) {
+        return false;
+    }
+    char *resolved = realpath(fileName.c_str(), 0);
+    key.path = resolved!=0 ? resolved : fileName;
+    free(resolved);
+#if defined __APPLE__
+    key.mtime = (long long) st.st_mtimespec.tv_sec * 1000000000LL + st.st_mtimespec.tv_nsec;
+#else
+    key.mtime = (long long) st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+#endif
+#endif
+    key.size = (long long) st.st_size;
+    return true;
+}
+
+
+std::shared_ptr<const OptionsParsedConfiguration>
+OptionsConfigurationCache::get(const FileKey &key, const std::string &reader) {
+    std::lock_guard<std::mutex> lock(getCacheMutex());
+    std::map<std::string, CacheEntry> &cache = getCache();
+    std::map<std::string, CacheEntry>::const_iterator i = cache.find(reader + '\n' + key.path);
+    if(i==cache.end() || (*i).second.mtime!=key.mtime || (*i).second.size!=key.size) {
+        return std::shared_ptr<const OptionsParsedConfiguration>();
+    }
+    return (*i).second.parsed;
+}
+
+
+void
+OptionsConfigurationCache::put(const FileKey &key, const std::string &reader, std::shared_ptr<const OptionsParsedConfiguration> parsed) {
+    CacheEntry e;
+    e.mtime = key.mtime;
+    e.size = key.size;
+    e.parsed = parsed;
+    std::lock_guard<std::mutex> lock(getCacheMutex());
+    getCache()[reader + '\n' + key.path] = e;
+}
+
+
+void
+OptionsConfigurationCache::clear() {
+    std::lock_guard<std::mutex> lock(getCacheMutex());
+    getCache().clear();
+}
+
+
+size_t
+OptionsConfigurationCache::size() {
+    std::lock_guard<std::mutex> lock(getCacheMutex());
+    return getCache().size();
+}
+
+
+// *************************************************************************
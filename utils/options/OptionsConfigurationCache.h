@@ -0,0 +1,112 @@
+#ifndef OptionsConfigurationCache_h
+#define OptionsConfigurationCache_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsConfigurationCache.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <memory>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class OptionsParsedConfiguration;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsConfigurationCache
+ * @brief A process-wide cache of parsed configuration files
+ *
+ * Parsed configurations are stored by the file's canonical path and the
+ *  reader that parsed it. Each entry remembers the file's modification time
+ *  and size; an entry is only returned while both are unchanged, so that
+ *  looking up a file costs a single stat call.
+ *
+ * All methods are thread-safe.
+ */
+class OptionsConfigurationCache {
+public:
+    /**
+     * @struct FileKey
+     * @brief Identifies a file's state
+     */
+    struct FileKey {
+        /// @brief The canonical path of the file
+        std::string path;
+        /// @brief The file's modification time in nanoseconds
+        long long mtime;
+        /// @brief The file's size
+        long long size;
+    };
+
+
+    /** @brief Determines the key of the named file
+     * @param[in] fileName The name of the file
+     * @param[out] key The file's key
+     * @return Whether the file exists
+     */
+    static bool getFileKey(const std::string &fileName, FileKey &key);
+
+
+    /** @brief Returns the configuration parsed from the given file by the given reader
+     * @param[in] key The file's key
+     * @param[in] reader The name of the reader
+     * @return The parsed configuration, an empty pointer if it is not cached or outdated
+     */
+    static std::shared_ptr<const OptionsParsedConfiguration> get(const FileKey &key, const std::string &reader);
+
+
+    /** @brief Stores a parsed configuration, replacing outdated ones
+     * @param[in] key The file's key
+     * @param[in] reader The name of the reader
+     * @param[in] parsed The parsed configuration
+     */
+    static void put(const FileKey &key, const std::string &reader, std::shared_ptr<const OptionsParsedConfiguration> parsed);
+
+
+    /// @brief Removes all cached configurations
+    static void clear();
+
+
+    /** @brief Returns the number of cached configurations
+     * @return The number of cached configurations
+     */
+    static size_t size();
+
+
+};
+
+
+// *************************************************************************
+#endif
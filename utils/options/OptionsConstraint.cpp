@@ -0,0 +1,215 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsConstraint.cpp
+   @since        19.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+#include "Option.h"
+#include "OptionsConstraint.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+/* -------------------------------------------------------------------------
+ * OptionsConstraint-methods
+ * ----------------------------------------------------------------------- */
+OptionsConstraint::OptionsConstraint() {
+}
+
+
+OptionsConstraint::~OptionsConstraint() {
+}
+
+
+void
+OptionsConstraint::check(double) const {
+    throw std::runtime_error("the constraint cannot be applied to numbers");
+}
+
+
+void
+OptionsConstraint::check(const std::string &) const {
+    throw std::runtime_error("the constraint cannot be applied to strings");
+}
+
+
+std::string
+OptionsConstraint::toString(double value) {
+    std::ostringstream oss;
+    oss << value;
+    return oss.str();
+}
+
+
+
+/* -------------------------------------------------------------------------
+ * OptionsRangeConstraint-methods
+ * ----------------------------------------------------------------------- */
+OptionsRangeConstraint::OptionsRangeConstraint(double min, double max, bool minInclusive, bool maxInclusive)
+    : myMin(min), myMax(max), myMinInclusive(minInclusive), myMaxInclusive(maxInclusive) {
+}
+
+
+OptionsRangeConstraint::~OptionsRangeConstraint() {
+}
+
+
+void
+OptionsRangeConstraint::check(double value) const {
+    if((myMinInclusive ? value>=myMin : value>myMin) && (myMaxInclusive ? value<=myMax : value<myMax)) {
+        return;
+    }
+    throw std::runtime_error("value " + toString(value) + " is not within "
+        + (myMinInclusive ? "[" : "(") + toString(myMin) + ", " + toString(myMax) + (myMaxInclusive ? "]" : ")"));
+}
+
+
+
+/* -------------------------------------------------------------------------
+ * OptionsChoicesConstraint-methods
+ * ----------------------------------------------------------------------- */
+OptionsChoicesConstraint::OptionsChoicesConstraint(const std::vector<std::string> &choices)
+    : myChoices(choices), mySortedChoices(choices) {
+    for(std::vector<std::string>::const_iterator i=choices.begin(); i!=choices.end(); ++i) {
+        try {
+            myNumbers.push_back(Option_Double::parseDouble((*i).c_str()));
+        } catch(std::runtime_error &) {
+            // not a number; only strings are compared with it
+        }
+    }
+    std::sort(mySortedChoices.begin(), mySortedChoices.end());
+    std::sort(myNumbers.begin(), myNumbers.end());
+}
+
+
+OptionsChoicesConstraint::~OptionsChoicesConstraint() {
+}
+
+
+void
+OptionsChoicesConstraint::check(double value) const {
+    if(!std::binary_search(myNumbers.begin(), myNumbers.end(), value)) {
+        throw std::runtime_error(getMessage(toString(value)));
+    }
+}
+
+
+void
+OptionsChoicesConstraint::check(const std::string &value) const {
+    if(!std::binary_search(mySortedChoices.begin(), mySortedChoices.end(), value)) {
+        throw std::runtime_error(getMessage("'" + value + "'"));
+    }
+}
+
+
+std::string
+OptionsChoicesConstraint::getMessage(const std::string &value) const {
+    std::string message = "value " + value + " is not one of ";
+    for(std::vector<std::string>::const_iterator i=myChoices.begin(); i!=myChoices.end(); ++i) {
+        message += (i!=myChoices.begin() ? ", '" : "'") + *i + "'";
+    }
+    return message;
+}
+
+
+
+/* -------------------------------------------------------------------------
+ * OptionsPatternConstraint-methods
+ * ----------------------------------------------------------------------- */
+OptionsPatternConstraint::OptionsPatternConstraint(const std::string &pattern)
+    : myPattern(pattern), myRegex(pattern, std::regex::ECMAScript | std::regex::optimize) {
+}
+
+
+OptionsPatternConstraint::~OptionsPatternConstraint() {
+}
+
+
+void
+OptionsPatternConstraint::check(const std::string &value) const {
+    if(!std::regex_match(value, myRegex)) {
+        throw std::runtime_error("value '" + value + "' does not match '" + myPattern + "'");
+    }
+}
+
+
+
+/* -------------------------------------------------------------------------
+ * OptionsNumberPredicateConstraint-methods
+ * ----------------------------------------------------------------------- */
+OptionsNumberPredicateConstraint::OptionsNumberPredicateConstraint(const std::function<bool(double)> &predicate, const std::string &message)
+    : myPredicate(predicate), myMessage(message) {
+}
+
+
+OptionsNumberPredicateConstraint::~OptionsNumberPredicateConstraint() {
+}
+
+
+void
+OptionsNumberPredicateConstraint::check(double value) const {
+    if(!myPredicate(value)) {
+        throw std::runtime_error("value " + toString(value) + " is not valid: " + myMessage);
+    }
+}
+
+
+
+/* -------------------------------------------------------------------------
+ * OptionsStringPredicateConstraint-methods
+ * ----------------------------------------------------------------------- */
+OptionsStringPredicateConstraint::OptionsStringPredicateConstraint(const std::function<bool(const std::string &)> &predicate, const std::string &message)
+    : myPredicate(predicate), myMessage(message) {
+}
+
+
+OptionsStringPredicateConstraint::~OptionsStringPredicateConstraint() {
+}
+
+
+void
+OptionsStringPredicateConstraint::check(const std::string &value) const {
+    if(!myPredicate(value)) {
+        throw std::runtime_error("value '" + value + "' is not valid: " + myMessage);
+    }
+}
+
+
+// *************************************************************************
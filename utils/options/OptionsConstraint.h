@@ -0,0 +1,303 @@
+#ifndef OptionsConstraint_h
+#define OptionsConstraint_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsConstraint.h
+   @since        19.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <regex>
+#include <functional>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsConstraint
+ * @brief A check of the values an option accepts
+ *
+ * Constraints are added to options (see Option::addConstraint and
+ *  OptionsCont::addConstraint) and checked when a value is set or validated,
+ *  after it has been parsed and before it is stored. Numeric options
+ *  (integer, double, their tunable variants, and typed options holding
+ *  numbers, see Option_Typed) are checked using the parsed number; string,
+ *  file name, enum, and other typed options using the string. Bool options
+ *  are not checked.
+ *
+ * Constraints are not changed after being built; copies of an option
+ *  share them.
+ */
+class OptionsConstraint {
+public:
+    /// @brief Destructor
+    virtual ~OptionsConstraint();
+
+
+    /** @brief Checks a number
+     *
+     * Throws unless overridden.
+     * @param[in] value The value to check
+     * @throw runtime_error If the value violates the constraint
+     */
+    virtual void check(double value) const;
+
+
+    /** @brief Checks a string
+     *
+     * Throws unless overridden.
+     * @param[in] value The value to check
+     * @throw runtime_error If the value violates the constraint
+     */
+    virtual void check(const std::string &value) const;
+
+
+protected:
+    /// @brief Constructor
+    OptionsConstraint();
+
+
+    /** @brief Returns the given number as a string
+     * @param[in] value The number
+     * @return The number's string representation
+     */
+    static std::string toString(double value);
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsConstraint(const OptionsConstraint &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsConstraint &operator=(const OptionsConstraint &s);
+
+
+};
+
+
+
+/**
+ * @class OptionsRangeConstraint
+ * @brief Accepts numbers within a range
+ */
+class OptionsRangeConstraint : public OptionsConstraint {
+public:
+    /** @brief Constructor
+     * @param[in] min The smallest number accepted
+     * @param[in] max The largest number accepted
+     * @param[in] minInclusive Whether min itself is accepted
+     * @param[in] maxInclusive Whether max itself is accepted
+     */
+    OptionsRangeConstraint(double min, double max, bool minInclusive=true, bool maxInclusive=true);
+
+
+    /// @brief Destructor
+    ~OptionsRangeConstraint();
+
+
+    /** @brief Checks whether the number is within the range
+     * @param[in] value The value to check
+     * @throw runtime_error If the value is not within the range
+     */
+    void check(double value) const;
+
+
+private:
+    /// @brief The bounds of the range
+    double myMin, myMax;
+
+    /// @brief Whether the bounds are accepted
+    bool myMinInclusive, myMaxInclusive;
+
+
+};
+
+
+
+/**
+ * @class OptionsChoicesConstraint
+ * @brief Accepts a set of values
+ *
+ * Numbers are compared with the numeric choices.
+ */
+class OptionsChoicesConstraint : public OptionsConstraint {
+public:
+    /** @brief Constructor
+     * @param[in] choices The accepted values
+     */
+    OptionsChoicesConstraint(const std::vector<std::string> &choices);
+
+
+    /// @brief Destructor
+    ~OptionsChoicesConstraint();
+
+
+    /** @brief Checks whether the number is one of the choices
+     * @param[in] value The value to check
+     * @throw runtime_error If the value is not one of the choices
+     */
+    void check(double value) const;
+
+
+    /** @brief Checks whether the string is one of the choices
+     * @param[in] value The value to check
+     * @throw runtime_error If the value is not one of the choices
+     */
+    void check(const std::string &value) const;
+
+
+private:
+    /// @brief Returns the message reporting that the value is not a choice
+    std::string getMessage(const std::string &value) const;
+
+
+private:
+    /// @brief The accepted values, as given
+    std::vector<std::string> myChoices;
+
+    /// @brief The accepted values, sorted
+    std::vector<std::string> mySortedChoices;
+
+    /// @brief The accepted values that are numbers, sorted
+    std::vector<double> myNumbers;
+
+
+};
+
+
+
+/**
+ * @class OptionsPatternConstraint
+ * @brief Accepts strings matching a regular expression (ECMAScript syntax)
+ */
+class OptionsPatternConstraint : public OptionsConstraint {
+public:
+    /** @brief Constructor, compiles the expression
+     * @param[in] pattern The regular expression the whole string must match
+     * @throw runtime_error (regex_error) If the expression is not valid
+     */
+    OptionsPatternConstraint(const std::string &pattern);
+
+
+    /// @brief Destructor
+    ~OptionsPatternConstraint();
+
+
+    /** @brief Checks whether the string matches the expression
+     * @param[in] value The value to check
+     * @throw runtime_error If the value does not match
+     */
+    void check(const std::string &value) const;
+
+
+private:
+    /// @brief The expression's text
+    std::string myPattern;
+
+    /// @brief The compiled expression
+    std::regex myRegex;
+
+
+};
+
+
+
+/**
+ * @class OptionsNumberPredicateConstraint
+ * @brief Accepts numbers for which the given function returns true
+ */
+class OptionsNumberPredicateConstraint : public OptionsConstraint {
+public:
+    /** @brief Constructor
+     * @param[in] predicate The function deciding whether a value is accepted
+     * @param[in] message The reason reported if a value is not accepted
+     */
+    OptionsNumberPredicateConstraint(const std::function<bool(double)> &predicate, const std::string &message);
+
+
+    /// @brief Destructor
+    ~OptionsNumberPredicateConstraint();
+
+
+    /** @brief Checks the number using the predicate
+     * @param[in] value The value to check
+     * @throw runtime_error If the predicate returns false
+     */
+    void check(double value) const;
+
+
+private:
+    /// @brief The predicate
+    std::function<bool(double)> myPredicate;
+
+    /// @brief The reason reported if a value is not accepted
+    std::string myMessage;
+
+
+};
+
+
+
+/**
+ * @class OptionsStringPredicateConstraint
+ * @brief Accepts strings for which the given function returns true
+ */
+class OptionsStringPredicateConstraint : public OptionsConstraint {
+public:
+    /** @brief Constructor
+     * @param[in] predicate The function deciding whether a value is accepted
+     * @param[in] message The reason reported if a value is not accepted
+     */
+    OptionsStringPredicateConstraint(const std::function<bool(const std::string &)> &predicate, const std::string &message);
+
+
+    /// @brief Destructor
+    ~OptionsStringPredicateConstraint();
+
+
+    /** @brief Checks the string using the predicate
+     * @param[in] value The value to check
+     * @throw runtime_error If the predicate returns false
+     */
+    void check(const std::string &value) const;
+
+
+private:
+    /// @brief The predicate
+    std::function<bool(const std::string &)> myPredicate;
+
+    /// @brief The reason reported if a value is not accepted
+    std::string myMessage;
+
+
+};
+
+
+// *************************************************************************
+#endif
@@ -25,8 +25,14 @@
 #include <vector>
 #include <algorithm>
 #include <cstdlib>
+#include <stdexcept>
+#include <iostream>
 #include "Option.h"
+#include "OptionsChangeListener.h"
 #include "OptionsCont.h"
+#include "OptionsHash.h"
+#include "OptionsBitset.h"
+#include "OptionsRule.h"
 
 /* -------------------------------------------------------------------------
  * (optional) memory checking
@@ -47,7 +53,8 @@ using namespace std;
 /* =========================================================================
  * method definitions
  * ======================================================================= */
-OptionsCont::OptionsCont() {
+OptionsCont::OptionsCont()
+    : mySchemaFingerprint(0), myAmLoading(false), mySubscriptionNumber(0), myBatchDepth(0) {
 }
 
 
@@ -78,12 +85,29 @@ OptionsCont::add(const std::string &name, Option *option) {
     // check whether a synonym already exists, if not, add the option to option's array
     std::vector<Option*>::const_iterator j = find(myOptions.begin(), myOptions.end(), option);
     if(j==myOptions.end()) {
+        myOption2Index[option] = myOptions.size();
         myOptions.push_back(option);
+        myOptionNames.push_back(name);
+        myFlags.resize(myOptions.size());
+        option->attach(&myFlags, myOptions.size()-1);
         // add the option to the sections, if given
         myOption2Section[option] = myCurrentSection;
+        if(mySubscriptionNumber.load(std::memory_order_relaxed)!=0) {
+            std::lock_guard<std::mutex> lock(mySubscriptionsLock);
+            updateSubscribed(myOptions.size()-1);
+        }
+    } else {
+        // the option is reported under its (alphabetically) last name
+        std::string &reportedName = myOptionNames[j-myOptions.begin()];
+        if(reportedName<name) {
+            reportedName = name;
+        }
     }
+    // the options' names (or the reported ones) changed
+    mySchemaFingerprint.store(0, std::memory_order_relaxed);
     // add the option to the name-to-option map
     myOptionsMap.insert(std::map<std::string, Option*>::value_type(name, option));
+    mySectionOptions[myOption2Section[option]][name] = option;
 }
 
 
@@ -123,9 +147,19 @@ OptionsCont::setDescription(const std::string &name, const std::string &desc, co
 }
 
 
+void
+OptionsCont::addConstraint(const std::string &name, OptionsConstraint *constraint) {
+    Option *o = getOption(name);
+    o->addConstraint(constraint);
+}
+
+
 void 
 OptionsCont::beginSection(const std::string &name) {
     myCurrentSection = name;
+    if(find(mySections.begin(), mySections.end(), name)==mySections.end()) {
+        mySections.push_back(name);
+    }
 }
 
 
@@ -142,8 +176,14 @@ OptionsCont::setHelpHeadAndTail(const std::string &head, const std::string &tail
  * ----------------------------------------------------------------------- */
 int
 OptionsCont::getInteger(const std::string &name) const {
-    Option_Integer *o = dynamic_cast<Option_Integer*>(getOption(name));
+    waitLoaded();
+    Option *option = getOption(name);
+    Option_Integer *o = dynamic_cast<Option_Integer*>(option);
     if(o==0) {
+        Option_TunableInteger *tunable = dynamic_cast<Option_TunableInteger*>(option);
+        if(tunable!=0) {
+            return tunable->getValue();
+        }
         throw std::runtime_error("Option '" + name + "' is not an integer option!");
     }
     if(!o->isSet()) {
@@ -155,6 +195,7 @@ OptionsCont::getInteger(const std::string &name) const {
 
 bool
 OptionsCont::getBool(const std::string &name) const {
+    waitLoaded();
     Option_Bool *o = dynamic_cast<Option_Bool*>(getOption(name));
     if(o==0) {
         throw std::runtime_error("Option '" + name + "' is not a bool option!");
@@ -168,8 +209,14 @@ OptionsCont::getBool(const std::string &name) const {
 
 double
 OptionsCont::getDouble(const std::string &name) const {
-    Option_Double *o = dynamic_cast<Option_Double*>(getOption(name));
+    waitLoaded();
+    Option *option = getOption(name);
+    Option_Double *o = dynamic_cast<Option_Double*>(option);
     if(o==0) {
+        Option_TunableDouble *tunable = dynamic_cast<Option_TunableDouble*>(option);
+        if(tunable!=0) {
+            return tunable->getValue();
+        }
         throw std::runtime_error("Option '" + name + "' is not a double option!");
     }
     if(!o->isSet()) {
@@ -181,6 +228,7 @@ OptionsCont::getDouble(const std::string &name) const {
 
 const std::string &
 OptionsCont::getString(const std::string &name) const {
+    waitLoaded();
     Option_String *o = dynamic_cast<Option_String*>(getOption(name));
     if(o==0) {
         throw std::runtime_error("Option '" + name + "' is not a string option!");
@@ -192,6 +240,20 @@ OptionsCont::getString(const std::string &name) const {
 }
 
 
+int
+OptionsCont::getEnum(const std::string &name) const {
+    waitLoaded();
+    Option_Enum *o = dynamic_cast<Option_Enum*>(getOption(name));
+    if(o==0) {
+        throw std::runtime_error("Option '" + name + "' is not an enum option!");
+    }
+    if(!o->isSet()) {
+        throw std::runtime_error("The option '" + name + "' is not set!");
+    }
+    return o->getValue();
+}
+
+
 std::string 
 OptionsCont::getValueAsString(const std::string &name) const {
     Option *o = getOption(name);
@@ -223,6 +285,24 @@ OptionsCont::isDefault(const std::string &name) const {
 }
 
 
+OptionsBitset
+OptionsCont::getSetOptions() const {
+    return myFlags.get(OptionsFlags::FLAG_SET);
+}
+
+
+OptionsBitset
+OptionsCont::getNonDefaultOptions() const {
+    return myFlags.get(OptionsFlags::FLAG_SET, OptionsFlags::FLAG_DEFAULT);
+}
+
+
+OptionsBitset
+OptionsCont::getSettableOptions() const {
+    return myFlags.get(OptionsFlags::FLAG_SETABLE);
+}
+
+
 bool
 OptionsCont::canBeSet(const std::string &name) const {
     Option *o = getOption(name);
@@ -230,13 +310,17 @@ OptionsCont::canBeSet(const std::string &name) const {
 }
 
 
+bool
+OptionsCont::isTunable(const std::string &name) const {
+    Option *o = getOption(name);
+    return o->isTunable();
+}
+
+
 bool
 OptionsCont::isBool(const std::string &name) const {
-    Option_Bool *o = dynamic_cast<Option_Bool*>(getOptionSecure(name));
-    if(o==0) {
-        return false;
-    }
-    return true;
+    Option *o = getOptionSecure(name);
+    return dynamic_cast<Option_Bool*>(o)!=0 || dynamic_cast<Option_TypedValue<bool>*>(o)!=0;
 }
 
 
@@ -269,14 +353,63 @@ OptionsCont::contains(const string &name) const {
 
 std::vector<std::string> 
 OptionsCont::getSortedOptionNames() const {
+    return myOptionNames;
+}
+
+
+std::vector<std::string>
+OptionsCont::getAllOptionNames() const {
     std::vector<std::string> ret;
-    for(std::vector<Option*>::const_iterator i=myOptions.begin(); i!=myOptions.end(); i++) {
-        ret.push_back(getSynonyms(*i).back());
+    ret.reserve(myOptionsMap.size());
+    for(std::map<std::string, Option*>::const_iterator i=myOptionsMap.begin(); i!=myOptionsMap.end(); i++) {
+        ret.push_back((*i).first);
     }
     return ret;
 }
 
+
+size_t
+OptionsCont::getOptionNumber() const {
+    return myOptions.size();
+}
+
+
+const Option &
+OptionsCont::getOptionAt(size_t index) const {
+    return *myOptions[index];
+}
+
+
+const std::string &
+OptionsCont::getOptionNameAt(size_t index) const {
+    return myOptionNames[index];
+}
+
+
+size_t
+OptionsCont::getOptionID(const std::string &name) const {
+    return myOption2Index.find(getOption(name))->second;
+}
+
     
+unsigned long long
+OptionsCont::getSchemaFingerprint() const {
+    unsigned long long hash = mySchemaFingerprint.load(std::memory_order_relaxed);
+    if(hash!=0) {
+        return hash;
+    }
+    hash = OptionsHash::OFFSET_BASIS;
+    for(size_t i=0; i<myOptions.size(); ++i) {
+        hash = OptionsHash::fnv1a(myOptionNames[i], hash);
+        hash = OptionsHash::fnv1a("", 1, hash);
+        hash = OptionsHash::fnv1a(myOptions[i]->getTypeName(), hash);
+        hash = OptionsHash::fnv1a("", 1, hash);
+    }
+    mySchemaFingerprint.store(hash, std::memory_order_relaxed);
+    return hash;
+}
+
+
 std::vector<std::string>
 OptionsCont::getSynonyms(const std::string &name) const {
     Option *option = getOption(name);
@@ -303,21 +436,52 @@ OptionsCont::getSynonyms(const Option* const option) const {
 void
 OptionsCont::set(const std::string &name, const std::string &value) {
     Option *o = getOption(name);
-    o->set(value);
+    if(mySubscriptionNumber.load(std::memory_order_relaxed)==0) {
+        o->set(value);
+        return;
+    }
+    setNotifying(o, value);
 }
 
 
 void
 OptionsCont::set(const std::string &name, bool value) {
-    Option_Bool *o = dynamic_cast<Option_Bool*>(getOption(name));
-    if(o==0) {
+    Option *o = getOption(name);
+    if(dynamic_cast<Option_Bool*>(o)==0 && dynamic_cast<Option_TypedValue<bool>*>(o)==0) {
         throw std::runtime_error("Option '" + name + "' is not a boolean option");
     }
-    if(value) {
-        o->set("true");
-    } else {
-        o->set("false");
+    set(name, std::string(value ? "true" : "false"));
+}
+
+
+void
+OptionsCont::tune(const std::string &name, const std::string &value) {
+    Option *o = getOption(name);
+    if(!o->isTunable()) {
+        throw std::runtime_error("Option '" + name + "' is not tunable.");
+    }
+    if(mySubscriptionNumber.load(std::memory_order_relaxed)==0) {
+        o->tune(value);
+        return;
+    }
+    setNotifying(o, value, true);
+}
+
+
+void
+OptionsCont::restore(size_t id, const Option &copy) {
+    Option *option = myOptions[id];
+    if(!myFlags.test(id, OptionsFlags::FLAG_SUBSCRIBED)) {
+        option->restore(copy);
+        return;
     }
+    bool wasSet = option->isSet();
+    std::string before = wasSet ? option->getValueAsString() : "";
+    option->restore(copy);
+    if(wasSet==option->isSet() && (!wasSet || before==option->getValueAsString())) {
+        return;
+    }
+    noteChange(id);
 }
 
 
@@ -347,6 +511,34 @@ OptionsCont::getSection(const std::string &optionName) const {
 }
 
 
+const std::vector<std::string> &
+OptionsCont::getSections() const {
+    return mySections;
+}
+
+
+bool
+OptionsCont::hasSection(const std::string &section) const {
+    return mySectionOptions.find(section)!=mySectionOptions.end();
+}
+
+
+bool
+OptionsCont::containsInSection(const std::string &section, const std::string &name) const {
+    std::map<std::string, std::map<std::string, Option*> >::const_iterator i = mySectionOptions.find(section);
+    if(i==mySectionOptions.end()) {
+        return false;
+    }
+    return (*i).second.find(name)!=(*i).second.end();
+}
+
+
+const std::string &
+OptionsCont::getSectionAt(size_t index) const {
+    return myOption2Section.find(myOptions[index])->second;
+}
+
+
 const std::string &
 OptionsCont::getDescription(const std::string &optionName) const {
     Option *option = getOption(optionName);
@@ -367,6 +559,289 @@ OptionsCont::getHelpTail() const {
 
 
 
+/* -------------------------------------------------------------------------
+ * Loading gate
+ * ----------------------------------------------------------------------- */
+void
+OptionsCont::beginLoading() {
+    std::lock_guard<std::mutex> lock(myLoadingLock);
+    // the loader claims the options itself; the calling thread may be a reader
+    myLoadingThread = std::thread::id();
+    myAmLoading.store(true, std::memory_order_release);
+}
+
+
+void
+OptionsCont::claimLoading() {
+    std::lock_guard<std::mutex> lock(myLoadingLock);
+    myLoadingThread = std::this_thread::get_id();
+}
+
+
+void
+OptionsCont::endLoading() {
+    {
+        std::lock_guard<std::mutex> lock(myLoadingLock);
+        myLoadingThread = std::thread::id();
+        myAmLoading.store(false, std::memory_order_release);
+    }
+    myLoadingCondition.notify_all();
+}
+
+
+bool
+OptionsCont::isLoading() const {
+    return myAmLoading.load(std::memory_order_acquire);
+}
+
+
+void
+OptionsCont::waitLoaded() const {
+    if(!myAmLoading.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(myLoadingLock);
+    if(std::this_thread::get_id()==myLoadingThread) {
+        return;
+    }
+    while(myAmLoading.load(std::memory_order_acquire)) {
+        myLoadingCondition.wait(lock);
+    }
+}
+
+
+
+/* -------------------------------------------------------------------------
+ * Change notifications
+ * ----------------------------------------------------------------------- */
+void
+OptionsCont::subscribe(const std::string &name, OptionsChangeListener *listener) {
+    size_t id = getOptionID(name);
+    std::lock_guard<std::mutex> lock(mySubscriptionsLock);
+    myOptionSubscriptions[id].push_back(listener);
+    ++mySubscriptionNumber;
+    myFlags.set(id, OptionsFlags::FLAG_SUBSCRIBED);
+}
+
+
+void
+OptionsCont::subscribeSection(const std::string &section, OptionsChangeListener *listener) {
+    if(!hasSection(section)) {
+        throw std::runtime_error("Section '" + section + "' is not known.");
+    }
+    std::lock_guard<std::mutex> lock(mySubscriptionsLock);
+    mySectionSubscriptions[section].push_back(listener);
+    ++mySubscriptionNumber;
+    const std::map<std::string, Option*> &options = mySectionOptions.find(section)->second;
+    for(std::map<std::string, Option*>::const_iterator i=options.begin(); i!=options.end(); ++i) {
+        myFlags.set((*i).second->myID, OptionsFlags::FLAG_SUBSCRIBED);
+    }
+}
+
+
+void
+OptionsCont::unsubscribe(OptionsChangeListener *listener) {
+    std::lock_guard<std::mutex> lock(mySubscriptionsLock);
+    for(std::map<size_t, std::vector<OptionsChangeListener*> >::iterator i=myOptionSubscriptions.begin(); i!=myOptionSubscriptions.end(); ) {
+        std::vector<OptionsChangeListener*> &listeners = (*i).second;
+        std::vector<OptionsChangeListener*>::iterator j = std::remove(listeners.begin(), listeners.end(), listener);
+        mySubscriptionNumber -= listeners.end() - j;
+        listeners.erase(j, listeners.end());
+        if(listeners.empty()) {
+            myOptionSubscriptions.erase(i++);
+        } else {
+            ++i;
+        }
+    }
+    for(std::map<std::string, std::vector<OptionsChangeListener*> >::iterator i=mySectionSubscriptions.begin(); i!=mySectionSubscriptions.end(); ) {
+        std::vector<OptionsChangeListener*> &listeners = (*i).second;
+        std::vector<OptionsChangeListener*>::iterator j = std::remove(listeners.begin(), listeners.end(), listener);
+        mySubscriptionNumber -= listeners.end() - j;
+        listeners.erase(j, listeners.end());
+        if(listeners.empty()) {
+            mySectionSubscriptions.erase(i++);
+        } else {
+            ++i;
+        }
+    }
+    for(size_t i=0; i<myOptions.size(); ++i) {
+        updateSubscribed(i);
+    }
+}
+
+
+void
+OptionsCont::beginBatch() {
+    std::lock_guard<std::mutex> lock(mySubscriptionsLock);
+    ++myBatchDepth;
+}
+
+
+void
+OptionsCont::endBatch() {
+    {
+        std::lock_guard<std::mutex> lock(mySubscriptionsLock);
+        if(myBatchDepth>0) {
+            --myBatchDepth;
+        }
+        if(myBatchDepth!=0 || myPendingChanges.findNext(0)==myPendingChanges.size()) {
+            return;
+        }
+    }
+    deliverChanges();
+}
+
+
+void
+OptionsCont::setNotifying(Option *option, const std::string &value, bool tune) {
+    size_t id = option->myID;
+    if(!myFlags.test(id, OptionsFlags::FLAG_SUBSCRIBED)) {
+        tune ? option->tune(value) : option->set(value);
+        return;
+    }
+    bool wasSet = option->isSet();
+    std::string before = wasSet ? option->getValueAsString() : "";
+    tune ? option->tune(value) : option->set(value);
+    if(wasSet && before==option->getValueAsString()) {
+        return;
+    }
+    noteChange(id);
+}
+
+
+void
+OptionsCont::updateSubscribed(size_t id) {
+    if(myOptionSubscriptions.find(id)!=myOptionSubscriptions.end()
+            || mySectionSubscriptions.find(myOption2Section.find(myOptions[id])->second)!=mySectionSubscriptions.end()) {
+        myFlags.set(id, OptionsFlags::FLAG_SUBSCRIBED);
+    } else {
+        myFlags.clear(id, OptionsFlags::FLAG_SUBSCRIBED);
+    }
+}
+
+
+void
+OptionsCont::noteChange(size_t id) {
+    {
+        std::lock_guard<std::mutex> lock(mySubscriptionsLock);
+        if(myPendingChanges.size()<myOptions.size()) {
+            myPendingChanges.resize(myOptions.size());
+        }
+        myPendingChanges.set(id);
+        if(myBatchDepth!=0) {
+            return;
+        }
+    }
+    deliverChanges();
+}
+
+
+void
+OptionsCont::noteChangeSince(size_t id, const Option &before) {
+    if(!myFlags.test(id, OptionsFlags::FLAG_SUBSCRIBED)) {
+        return;
+    }
+    const Option *option = myOptions[id];
+    if(before.isSet()==option->isSet() && (!before.isSet() || before.getValueAsString()==option->getValueAsString())) {
+        return;
+    }
+    noteChange(id);
+}
+
+
+void
+OptionsCont::deliverChanges() {
+    // collect the changes per listener, keeping the order of subscription
+    std::vector<OptionsChangeListener*> listeners;
+    std::map<OptionsChangeListener*, std::vector<size_t> > changes;
+    {
+        std::lock_guard<std::mutex> lock(mySubscriptionsLock);
+        // the changes are collected in the order of the options' IDs
+        for(size_t i=myPendingChanges.findNext(0); i<myPendingChanges.size(); i=myPendingChanges.findNext(i+1)) {
+            std::vector<OptionsChangeListener*> subscribed;
+            std::map<size_t, std::vector<OptionsChangeListener*> >::const_iterator j = myOptionSubscriptions.find(i);
+            if(j!=myOptionSubscriptions.end()) {
+                subscribed = (*j).second;
+            }
+            std::map<std::string, std::vector<OptionsChangeListener*> >::const_iterator k = mySectionSubscriptions.find(myOption2Section.find(myOptions[i])->second);
+            if(k!=mySectionSubscriptions.end()) {
+                subscribed.insert(subscribed.end(), (*k).second.begin(), (*k).second.end());
+            }
+            for(std::vector<OptionsChangeListener*>::const_iterator l=subscribed.begin(); l!=subscribed.end(); ++l) {
+                std::vector<size_t> &ids = changes[*l];
+                if(ids.empty()) {
+                    listeners.push_back(*l);
+                }
+                if(ids.empty() || ids.back()!=i) {
+                    ids.push_back(i);
+                }
+            }
+        }
+        myPendingChanges.clear();
+    }
+    for(std::vector<OptionsChangeListener*>::const_iterator i=listeners.begin(); i!=listeners.end(); ++i) {
+        (*i)->optionsChanged(*this, changes[*i]);
+    }
+}
+
+
+
+/* -------------------------------------------------------------------------
+ * Rules on given options
+ * ----------------------------------------------------------------------- */
+void
+OptionsCont::addRequires(const std::string &name, const std::vector<std::string> &required) {
+    myRules.push_back(OptionsRule(OptionsRule::RULE_REQUIRES, getOptionIDs(std::vector<std::string>(1, name)), std::vector<std::string>(1, name), getOptionIDs(required), required));
+}
+
+
+void
+OptionsCont::addConflicts(const std::vector<std::string> &names) {
+    myRules.push_back(OptionsRule(OptionsRule::RULE_CONFLICTS, getOptionIDs(names), names));
+}
+
+
+void
+OptionsCont::addOneOf(const std::vector<std::string> &names) {
+    myRules.push_back(OptionsRule(OptionsRule::RULE_ONE_OF, getOptionIDs(names), names));
+}
+
+
+void
+OptionsCont::addAtLeastOne(const std::vector<std::string> &names) {
+    myRules.push_back(OptionsRule(OptionsRule::RULE_AT_LEAST_ONE, getOptionIDs(names), names));
+}
+
+
+void
+OptionsCont::checkRules() const {
+    if(myRules.empty()) {
+        return;
+    }
+    OptionsBitset given = getNonDefaultOptions();
+    std::string errors, error;
+    for(std::vector<OptionsRule>::const_iterator i=myRules.begin(); i!=myRules.end(); ++i) {
+        if(!(*i).check(given, error)) {
+            errors += (errors.length()!=0 ? "\n" : "") + error;
+        }
+    }
+    if(errors.length()!=0) {
+        throw std::runtime_error(errors);
+    }
+}
+
+
+std::vector<size_t>
+OptionsCont::getOptionIDs(const std::vector<std::string> &names) const {
+    std::vector<size_t> ids;
+    for(std::vector<std::string>::const_iterator i=names.begin(); i!=names.end(); ++i) {
+        ids.push_back(getOptionID(*i));
+    }
+    return ids;
+}
+
+
+
 /* -------------------------------------------------------------------------
  * Configuration Hierarchy Name Handling
  * ----------------------------------------------------------------------- */
@@ -400,25 +875,23 @@ OptionsCont::convert(char abbr) {
 
 std::ostream &
 operator<<(std::ostream &os, const OptionsCont &oc) {
-    vector<string> known;
-    known.reserve(oc.myOptionsMap.size());
-    for(std::map<std::string, Option*>::const_iterator i=oc.myOptionsMap.begin(); i!=oc.myOptionsMap.end(); i++) {
-        vector<string>::iterator j=find(known.begin(), known.end(), (*i).first);
-        if(j!=known.end()) {
-            continue;
-        }
+    // each set option is printed once, under its alphabetically first name
+    OptionsBitset toPrint = oc.getSetOptions();
+    size_t remaining = toPrint.count();
+    for(std::map<std::string, Option*>::const_iterator i=oc.myOptionsMap.begin(); i!=oc.myOptionsMap.end() && remaining!=0; i++) {
         Option *o = (*i).second;
-        if(!o->isSet()) {
+        size_t id = oc.myOption2Index.find(o)->second;
+        if(!toPrint.test(id)) {
             continue;
         }
-        vector<string> synonyms = oc.getSynonyms((*i).first);
+        toPrint.set(id, false);
+        --remaining;
+        vector<string> synonyms = oc.getSynonyms(o);
         vector<string>::iterator k = synonyms.begin();
-        known.push_back(*k);
         os << *k;
         if(synonyms.size()>1) {
             os << " (";
             for(++k; k!=synonyms.end();) {
-                known.push_back(*k);
                 os << *k++;
                 if(k!=synonyms.end()) {
                     os << ", ";
@@ -24,6 +24,15 @@
 #include <map>
 #include <string>
 #include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <stdexcept>
+#include "OptionTyped.h"
+#include "OptionsRule.h"
+#include "OptionsBitset.h"
+#include "OptionsFlags.h"
 
 /* -------------------------------------------------------------------
  * (optional) memory checking
@@ -38,6 +47,9 @@
  * ======================================================================= */
 class Option;
 class Option_String;
+class OptionsChangeListener;
+class OptionsConstraint;
+template<class OptionType, typename ValueType> class OptionsHandle;
 
 
 /* =========================================================================
@@ -83,6 +95,13 @@ public:
     void add(const std::string &name, char abbr, Option *option);
 
 
+    /** @brief Adds a constraint the named option's values must fulfil (see OptionsConstraint)
+	 * @param[in] name The name of the option
+	 * @param[in] constraint The constraint to add (the option takes ownership)
+	 */
+    void addConstraint(const std::string &name, OptionsConstraint *constraint);
+
+
     /** @brief Registers a known option under the other synonym
 	 * @param[in] name1 The name the option was already known under
 	 * @param[in] name2 The synonym to register
@@ -92,6 +111,52 @@ public:
 
 
 
+    /// @brief Rules on Given Options
+    /// @{
+
+    /** @brief Adds the rule that if the named option is given, the other ones must be given as well
+     *
+     * An option is given if it was set, not only defaulted. The rules are
+     *  checked by checkRules (called by OptionsIO::parseAndLoad).
+	 * @param[in] name The name of the option
+	 * @param[in] required The names of the options it requires
+	 * @throw runtime_error If an option is not known
+	 */
+    void addRequires(const std::string &name, const std::vector<std::string> &required);
+
+
+    /** @brief Adds the rule that at most one of the named options may be given
+	 * @param[in] names The names of the conflicting options
+	 * @throw runtime_error If an option is not known
+	 */
+    void addConflicts(const std::vector<std::string> &names);
+
+
+    /** @brief Adds the rule that exactly one of the named options must be given
+	 * @param[in] names The names of the options
+	 * @throw runtime_error If an option is not known
+	 */
+    void addOneOf(const std::vector<std::string> &names);
+
+
+    /** @brief Adds the rule that at least one of the named options must be given
+	 * @param[in] names The names of the options
+	 * @throw runtime_error If an option is not known
+	 */
+    void addAtLeastOne(const std::vector<std::string> &names);
+
+
+    /** @brief Checks all rules
+     *
+     * The given options are read as a bitset once (see getNonDefaultOptions);
+     *  each rule is checked by counting the bits of its masks.
+	 * @throw runtime_error Listing all violated rules, one per line
+	 */
+    void checkRules() const;
+    /// @}
+
+
+
     /// @brief Filling Help Information
     /// @{
 
@@ -126,6 +191,8 @@ public:
     /// @{
 
     /** @brief Returns the integer value of the named option
+     *
+     * The typed getters wait if the options are being loaded (see beginLoading).
      * @param[in] name The name of the option to retrieve the value from
 	 * @return The named option's value
 	 */
@@ -153,6 +220,32 @@ public:
     const std::string &getString(const std::string &name) const;
 
 
+    /** @brief Returns the code of the named enum option's value (see Option_Enum)
+     * @param[in] name The name of the option to retrieve the value from
+     * @return The index of the named option's value within its choices
+     */
+    int getEnum(const std::string &name) const;
+
+
+    /** @brief Returns the value of the named typed option (see Option_Typed)
+     * @param[in] name The name of the option to retrieve the value from
+     * @return The named option's value
+     * @throw runtime_error If the option is not known, not of the type, or not set
+     */
+    template<typename T>
+    const T &get(const std::string &name) const {
+        waitLoaded();
+        const Option_TypedValue<T> *o = dynamic_cast<const Option_TypedValue<T>*>(getOption(name));
+        if(o==0) {
+            throw std::runtime_error("Option '" + name + "' is not of the requested type!");
+        }
+        if(!o->isSet()) {
+            throw std::runtime_error("The option '" + name + "' is not set!");
+        }
+        return o->getValue();
+    }
+
+
     /** @brief Returns the value of the named option as a string
      * @param[in] name The name of the option to retrieve the value from
      * @return The string representation of the option's value
@@ -188,6 +281,35 @@ public:
     bool isDefault(const std::string &name) const;
 
 
+    /** @brief Returns the options that are set (given or defaulted)
+     *
+     * The sets are read from bitsets the options write their state to, so
+     *  the options are not visited; count() and findNext() of the returned
+     *  set use popcount and find-first-set.
+     * @return The IDs of the set options (see getOptionAt)
+     */
+    OptionsBitset getSetOptions() const;
+
+
+    /** @brief Returns the options that are set but do not have their default value
+     * @return The IDs of the set, non-default options (see getOptionAt)
+     */
+    OptionsBitset getNonDefaultOptions() const;
+
+
+    /** @brief Returns the options that may be set
+     * @return The IDs of the settable options (see getOptionAt)
+     */
+    OptionsBitset getSettableOptions() const;
+
+
+    /** @brief Returns whether the named option may be changed at runtime (see tune())
+	 * @param[in] name The name of the option to check
+	 * @return Whether the option is tunable
+	 */
+    bool isTunable(const std::string &name) const;
+
+
     /** @brief Returns the information whether the option is a boolean option
 	 * @param[in] name The name of the option to check
 	 * @return Whether the option stores a bool
@@ -208,6 +330,62 @@ public:
     std::vector<std::string> getSortedOptionNames() const;
 
 
+    /** @brief Returns all names options are known under
+     *
+     * Includes synonyms and abbreviations.
+     * @return All known option names (sorted alphabetically)
+     */
+    std::vector<std::string> getAllOptionNames() const;
+
+
+    /** @brief Returns the number of known options
+     *
+     * Synonyms are not counted, each option is reported once.
+     * @return The number of known options
+     */
+    size_t getOptionNumber() const;
+
+
+    /** @brief Returns the option stored at the given index
+     *
+     * Options are indexed in the order they were added. Allows to iterate
+     *  over the options without looking them up by name.
+     * @param[in] index The index of the option (0 <= index < getOptionNumber())
+     * @return The option stored at the given index
+     */
+    const Option &getOptionAt(size_t index) const;
+
+
+    /** @brief Returns the name of the option stored at the given index
+     *
+     * This is the name the option is reported under by getSortedOptionNames().
+     * @param[in] index The index of the option (0 <= index < getOptionNumber())
+     * @return The name of the option stored at the given index
+     */
+    const std::string &getOptionNameAt(size_t index) const;
+
+
+    /** @brief Returns the ID of the named option
+     *
+     * The ID is the option's index as used by getOptionAt; all synonyms
+     *  of an option share the same ID.
+     * @param[in] name The name of the option
+     * @return The option's ID
+     * @throw runtime_error If the option is not known
+     */
+    size_t getOptionID(const std::string &name) const;
+
+
+    /** @brief Returns a fingerprint of the known options
+     *
+     * The fingerprint is a hash over the options' names and types in the
+     *  order of their IDs; containers built by the same code have the same
+     *  fingerprint. It is computed once and kept until an option is added.
+     * @return The options' fingerprint
+     */
+    unsigned long long getSchemaFingerprint() const;
+
+
     /** @brief Returns the list of synonyms to the given option name
 	 * @param[in] name The name of the option
 	 * @return List of this option's names
@@ -241,6 +419,26 @@ public:
     void set(const std::string &name, bool value=true);
 
 
+    /** @brief Changes the value of a tunable option at runtime
+     *
+     * Other than set(), the value may be changed repeatedly, also while
+     *  other threads read it. Subscribers are informed about the change.
+     * @param[in] name The name of the option to change
+     * @param[in] value The value to set
+     * @throw runtime_error If the option is not known or not tunable, or the value is invalid
+     */
+    void tune(const std::string &name, const std::string &value);
+
+
+    /** @brief Sets an option to the state of a copy made before (see Option::restore)
+     *
+     * Used to undo changes. Subscribers are informed if the value changes.
+     * @param[in] id The ID of the option to restore
+     * @param[in] copy A copy of the option, made using Option::clone()
+     */
+    void restore(size_t id, const Option &copy);
+
+
     /// @brief Remarks all options as unset
     void remarkUnset();
 
@@ -263,6 +461,34 @@ public:
     const std::string &getSection(const std::string &optionName) const;
 
 
+    /** @brief Returns the names of the sections in the order they were begun
+     * @return The names of the sections
+     */
+    const std::vector<std::string> &getSections() const;
+
+
+    /** @brief Returns whether the named section is known
+     * @param[in] section The name of the section
+     * @return Whether options were added to the named section
+     */
+    bool hasSection(const std::string &section) const;
+
+
+    /** @brief Returns whether an option with the given name belongs to the named section
+     * @param[in] section The name of the section
+     * @param[in] name The name of the option
+     * @return Whether the named option is known and belongs to the named section
+     */
+    bool containsInSection(const std::string &section, const std::string &name) const;
+
+
+    /** @brief Returns the name of the section the option at the given index belongs to
+     * @param[in] index The index of the option (0 <= index < getOptionNumber())
+     * @return The name of the section the option belongs to
+     */
+    const std::string &getSectionAt(size_t index) const;
+
+
     /** @brief Returns the description of the named option
      * @param[in] optionName The name of the option to return the description for
      * @return The description of the option
@@ -297,6 +523,81 @@ public:
 
 
 
+    /// @brief Loading gate
+    /// @{
+
+    /** @brief Marks the options as being loaded
+     *
+     * Until endLoading is called, the typed getters and the typed handles
+     *  block if they are called from another thread than the loading one.
+     *  No thread is the loading one until it declares so using claimLoading.
+     */
+    void beginLoading();
+
+
+    /// @brief Declares the calling thread as the one that loads the options
+    void claimLoading();
+
+
+    /// @brief Marks the options as loaded and releases waiting readers
+    void endLoading();
+
+
+    /** @brief Returns whether the options are being loaded
+     * @return Whether the options are being loaded
+     */
+    bool isLoading() const;
+
+
+    /// @brief Waits until loading has finished (returns at once if called by the loading thread)
+    void waitLoaded() const;
+    /// @}
+
+
+
+    /// @brief Change notifications
+    /// @{
+
+    /** @brief Subscribes a listener to changes of the named option
+     *
+     * The listener is informed if set() changes the option's value. Options
+     *  nobody subscribed to are set without any bookkeeping.
+     * @param[in] name The name of the option
+     * @param[in] listener The listener to inform (not owned)
+     * @throw runtime_error If the option is not known
+     */
+    void subscribe(const std::string &name, OptionsChangeListener *listener);
+
+
+    /** @brief Subscribes a listener to changes of the options of the named section
+     * @param[in] section The name of the section
+     * @param[in] listener The listener to inform (not owned)
+     * @throw runtime_error If the section is not known
+     */
+    void subscribeSection(const std::string &section, OptionsChangeListener *listener);
+
+
+    /** @brief Removes all subscriptions of the given listener
+     * @param[in] listener The listener to remove
+     */
+    void unsubscribe(OptionsChangeListener *listener);
+
+
+    /** @brief Starts a batch of changes
+     *
+     * Changes made until the matching endBatch are delivered at once; each
+     *  listener is called once with the IDs of all changed options it
+     *  subscribed to. Batches may be nested.
+     */
+    void beginBatch();
+
+
+    /// @brief Ends a batch of changes, delivering them if it was the outermost one
+    void endBatch();
+    /// @}
+
+
+
     /// @brief Retrieving Help Information
     /// @{
 
@@ -352,6 +653,47 @@ private:
 	 * @return The abbreviated name as a string
 	 */
     std::string convert(char abbr);
+
+
+    /** @brief Sets the option's value and notes the change if the option is subscribed
+	 * @param[in] option The option to set
+	 * @param[in] value The value to set
+	 * @param[in] tune Whether the value shall be tuned instead of being set
+	 */
+    void setNotifying(Option *option, const std::string &value, bool tune=false);
+
+
+    /** @brief Updates whether the option or its section has subscribers (see OptionsFlags::FLAG_SUBSCRIBED)
+     *
+     * The subscriptions lock must be held.
+	 * @param[in] id The ID of the option
+	 */
+    void updateSubscribed(size_t id);
+
+
+    /** @brief Notes that the value of an option has changed and delivers the change unless a batch is open
+	 * @param[in] id The ID of the changed option
+	 */
+    void noteChange(size_t id);
+
+
+    /** @brief Notes a change of a subscribed option if its value differs from the given former state
+	 * @param[in] id The ID of the option
+	 * @param[in] before A copy of the option taken before it was changed
+	 */
+    void noteChangeSince(size_t id, const Option &before);
+
+
+    /// @brief Informs the listeners about the changes noted so far
+    void deliverChanges();
+
+
+    /** @brief Returns the IDs of the named options
+	 * @param[in] names The names of the options
+	 * @return The options' IDs
+	 * @throw runtime_error If an option is not known
+	 */
+    std::vector<size_t> getOptionIDs(const std::vector<std::string> &names) const;
     /// @}
 
 
@@ -363,12 +705,24 @@ private:
     /// @brief The list of known options
     std::vector<Option*> myOptions;
 
+    /// @brief The names the options are reported under (same order as myOptions)
+    std::vector<std::string> myOptionNames;
+
+    /// @brief The fingerprint of the options, 0 if not computed yet (see getSchemaFingerprint)
+    mutable std::atomic<unsigned long long> mySchemaFingerprint;
+
     /// @brief The sections
     std::vector<std::string> mySections;
 
     /// @brief The option's assignment to sections
     std::map<Option*, std::string> myOption2Section;
 
+    /// @brief The options' indices in myOptions
+    std::map<Option*, size_t> myOption2Index;
+
+    /// @brief A per-section index of option names
+    std::map<std::string, std::map<std::string, Option*> > mySectionOptions;
+
     /// @brief THe last section added
     std::string myCurrentSection;
 
@@ -378,6 +732,46 @@ private:
     /// @brief The name of the option that defines the parent configuration
     std::string myParentConfigurationName;
 
+    /// @brief Whether the options are being loaded
+    std::atomic<bool> myAmLoading;
+
+    /// @brief The thread that loads the options
+    std::thread::id myLoadingThread;
+
+    /// @brief A lock for the loading state
+    mutable std::mutex myLoadingLock;
+
+    /// @brief The condition readers wait on while the options are being loaded
+    mutable std::condition_variable myLoadingCondition;
+
+    /// @brief The number of subscriptions
+    std::atomic<size_t> mySubscriptionNumber;
+
+    /// @brief The listeners subscribed to options by option ID
+    std::map<size_t, std::vector<OptionsChangeListener*> > myOptionSubscriptions;
+
+    /// @brief The listeners subscribed to sections by section name
+    std::map<std::string, std::vector<OptionsChangeListener*> > mySectionSubscriptions;
+
+    /// @brief The subscribed options changed within the current batch, a bit per option ID
+    OptionsBitset myPendingChanges;
+
+    /// @brief The nesting depth of batches
+    int myBatchDepth;
+
+    /// @brief A lock for the subscriptions and the pending changes
+    std::mutex mySubscriptionsLock;
+
+    /// @brief The rules on given options
+    std::vector<OptionsRule> myRules;
+
+    /// @brief The state flags of the options, indexed by ID
+    OptionsFlags myFlags;
+
+
+    template<class OptionType, typename ValueType> friend class OptionsHandle;
+    friend class OptionsTransaction;
+
 
 private:
     /// @brief Invalidated copy constructor
@@ -0,0 +1,345 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsControlServer.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <map>
+#include <thread>
+#include <sstream>
+#include <iostream>
+#include <stdexcept>
+#include <cstring>
+#include <cerrno>
+#ifndef _WIN32
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#endif
+#include "Option.h"
+#include "OptionsBatchScope.h"
+#include "OptionsCont.h"
+#include "OptionsTypedFileIO.h"
+#include "OptionsControlServer.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * definitions
+ * ======================================================================= */
+/// @brief The maximum length of a request; longer ones close the connection
+#define MAX_REQUEST_LENGTH 65536
+
+/// @brief Flags for sending answers; a closed connection shall not raise SIGPIPE
+#ifdef MSG_NOSIGNAL
+#define SEND_FLAGS MSG_NOSIGNAL
+#else
+#define SEND_FLAGS 0
+#endif
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+OptionsControlServer::OptionsControlServer(OptionsCont &options)
+    : myOptions(options), myReader(0), myListenFD(-1) {
+    myStopPipe[0] = myStopPipe[1] = -1;
+}
+
+
+OptionsControlServer::~OptionsControlServer() {
+    stop();
+}
+
+
+void
+OptionsControlServer::setReloading(OptionsTypedFileIO *reader, const std::string &configOptionName) {
+    myReader = reader;
+    myConfigOptionName = configOptionName;
+}
+
+
+bool
+OptionsControlServer::start(const std::string &socketPath) {
+#ifndef _WIN32
+    if(myThread.joinable()) {
+        return true;
+    }
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    if(socketPath.length()>=sizeof(address.sun_path)) {
+        std::cerr << std::endl << "Error: The control socket path '" << socketPath << "' is too long." << std::endl;
+        return false;
+    }
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socketPath.c_str());
+    myListenFD = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(myListenFD<0) {
+        std::cerr << std::endl << "Error: Could not create the control socket." << std::endl;
+        return false;
+    }
+    fcntl(myListenFD, F_SETFD, FD_CLOEXEC);
+    fcntl(myListenFD, F_SETFL, O_NONBLOCK);
+    unlink(socketPath.c_str());
+    // only the process' user may connect
+    mode_t mask = umask(0077);
+    bool bound = bind(myListenFD, (struct sockaddr*) &address, sizeof(address))==0;
+    umask(mask);
+    if(!bound || listen(myListenFD, SOMAXCONN)!=0) {
+        std::cerr << std::endl << "Error: Could not listen on the control socket '" << socketPath << "'." << std::endl;
+        close(myListenFD);
+        myListenFD = -1;
+        return false;
+    }
+    mySocketPath = socketPath;
+    if(pipe(myStopPipe)!=0) {
+        std::cerr << std::endl << "Error: Could not create the control server's pipe." << std::endl;
+        stop();
+        return false;
+    }
+    myThread = std::thread(&OptionsControlServer::run, this);
+    return true;
+#else
+    std::cerr << std::endl << "Error: The control server is not supported on this platform." << std::endl;
+    return false;
+#endif
+}
+
+
+void
+OptionsControlServer::stop() {
+#ifndef _WIN32
+    if(myThread.joinable()) {
+        // the thread polls the descriptors closed below; it has to be left first
+        char c = 0;
+        ssize_t written;
+        do {
+            written = write(myStopPipe[1], &c, 1);
+        } while(written<0 && errno==EINTR);
+        myThread.join();
+    }
+    for(int i=0; i<2; ++i) {
+        if(myStopPipe[i]>=0) {
+            close(myStopPipe[i]);
+            myStopPipe[i] = -1;
+        }
+    }
+    for(std::map<int, Connection>::const_iterator i=myConnections.begin(); i!=myConnections.end(); ++i) {
+        close((*i).first);
+    }
+    myConnections.clear();
+    if(myListenFD>=0) {
+        close(myListenFD);
+        myListenFD = -1;
+        unlink(mySocketPath.c_str());
+    }
+#endif
+}
+
+
+std::string
+OptionsControlServer::process(const std::string &request) {
+    std::string line = request;
+    if(line.length()!=0 && line[line.length()-1]=='\r') {
+        line = line.substr(0, line.length()-1);
+    }
+    std::istringstream iss(line);
+    std::string command, name;
+    iss >> command >> name;
+    if(command=="") {
+        return "";
+    }
+    std::ostringstream oss;
+    try {
+        if(command=="get" && name!="") {
+            if(!myOptions.isSet(name)) {
+                throw std::runtime_error("The option '" + name + "' is not set!");
+            }
+            oss << "OK " << myOptions.getValueAsString(name) << "\n";
+        } else if(command=="set" && name!="") {
+            std::string value;
+            std::getline(iss >> std::ws, value);
+            myOptions.tune(name, value);
+            oss << "OK\n";
+        } else if(command=="list") {
+            std::vector<std::string> names = myOptions.getSortedOptionNames();
+            oss << "OK " << names.size() << "\n";
+            for(std::vector<std::string>::const_iterator i=names.begin(); i!=names.end(); ++i) {
+                oss << *i << " " << myOptions.getTypeName(*i);
+                if(myOptions.isTunable(*i)) {
+                    oss << " tunable";
+                }
+                oss << "\n";
+            }
+        } else if(command=="dump") {
+            std::vector<std::string> names = myOptions.getSortedOptionNames();
+            std::ostringstream values;
+            size_t number = 0;
+            for(std::vector<std::string>::const_iterator i=names.begin(); i!=names.end(); ++i) {
+                if(myOptions.isSet(*i)) {
+                    values << *i << "=" << myOptions.getValueAsString(*i) << "\n";
+                    ++number;
+                }
+            }
+            oss << "OK " << number << "\n" << values.str();
+        } else if(command=="reload") {
+            if(myReader==0) {
+                throw std::runtime_error("Reloading is not enabled.");
+            }
+            std::vector<size_t> changed;
+            bool ok;
+            {
+                // only tunable options may change, so that readers are never blocked;
+                //  subscribers get the changes at once
+                OptionsBatchScope batch(myOptions);
+                ok = myReader->reloadConfiguration(myOptions, myConfigOptionName, changed, true);
+            }
+            if(!ok) {
+                throw std::runtime_error("The configuration could not be reloaded.");
+            }
+            oss << "OK " << changed.size() << "\n";
+        } else {
+            throw std::runtime_error("Unknown request '" + line + "'.");
+        }
+    } catch(std::runtime_error &e) {
+        return std::string("ERR ") + e.what() + "\n";
+    }
+    return oss.str();
+}
+
+
+void
+OptionsControlServer::run() {
+#ifndef _WIN32
+    std::vector<struct pollfd> fds;
+    while(true) {
+        fds.clear();
+        struct pollfd fd;
+        fd.fd = myStopPipe[0];
+        fd.events = POLLIN;
+        fd.revents = 0;
+        fds.push_back(fd);
+        fd.fd = myListenFD;
+        fds.push_back(fd);
+        for(std::map<int, Connection>::const_iterator i=myConnections.begin(); i!=myConnections.end(); ++i) {
+            fd.fd = (*i).first;
+            fd.events = (*i).second.output.empty() ? POLLIN : POLLOUT;
+            fds.push_back(fd);
+        }
+        if(poll(&fds[0], fds.size(), -1)<0) {
+            continue;
+        }
+        if(fds[0].revents!=0) {
+            return;
+        }
+        for(std::vector<struct pollfd>::const_iterator i=fds.begin()+2; i!=fds.end(); ++i) {
+            if((*i).revents==0) {
+                continue;
+            }
+            bool keep = true;
+            if(((*i).revents&POLLOUT)!=0) {
+                keep = writeAnswers((*i).fd);
+            } else if(((*i).revents&(POLLIN|POLLHUP|POLLERR))!=0) {
+                keep = readRequests((*i).fd);
+            }
+            if(!keep) {
+                close((*i).fd);
+                myConnections.erase((*i).fd);
+            }
+        }
+        if((fds[1].revents&POLLIN)!=0) {
+            int client;
+            while((client=accept(myListenFD, 0, 0))>=0) {
+                fcntl(client, F_SETFD, FD_CLOEXEC);
+                fcntl(client, F_SETFL, O_NONBLOCK);
+                myConnections[client];
+            }
+        }
+    }
+#endif
+}
+
+
+bool
+OptionsControlServer::readRequests(int fd) {
+#ifndef _WIN32
+    Connection &connection = myConnections[fd];
+    char buffer[4096];
+    ssize_t length = read(fd, buffer, sizeof(buffer));
+    if(length<=0) {
+        return false;
+    }
+    connection.input.append(buffer, length);
+    size_t beg = 0;
+    size_t end;
+    while((end=connection.input.find('\n', beg))!=std::string::npos) {
+        connection.output += process(connection.input.substr(beg, end-beg));
+        beg = end + 1;
+    }
+    connection.input.erase(0, beg);
+    if(connection.input.length()>MAX_REQUEST_LENGTH) {
+        return false;
+    }
+    return connection.output.empty() || writeAnswers(fd);
+#else
+    return false;
+#endif
+}
+
+
+bool
+OptionsControlServer::writeAnswers(int fd) {
+#ifndef _WIN32
+    Connection &connection = myConnections[fd];
+    while(!connection.output.empty()) {
+        ssize_t length = send(fd, connection.output.data(), connection.output.length(), SEND_FLAGS);
+        if(length<0) {
+            // the answer is sent when the connection becomes writable again
+            return errno==EAGAIN || errno==EWOULDBLOCK;
+        }
+        connection.output.erase(0, length);
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+// *************************************************************************
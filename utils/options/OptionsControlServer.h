@@ -0,0 +1,185 @@
+#ifndef OptionsControlServer_h
+#define OptionsControlServer_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsControlServer.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <map>
+#include <thread>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class OptionsCont;
+class OptionsTypedFileIO;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsControlServer
+ * @brief Answers requests for inspecting and tuning options on a Unix domain socket
+ *
+ * The server speaks a line protocol; each request is a line, each answer
+ *  starts with "OK" or "ERR":
+ * @arg get NAME: "OK VALUE"
+ * @arg set NAME VALUE: changes a tunable option (see OptionsCont::tune), "OK"
+ * @arg list: "OK N", followed by N lines "NAME TYPE", with " tunable" appended for tunable options
+ * @arg dump: "OK N", followed by N lines "NAME=VALUE" of the set options
+ * @arg reload: reloads the configuration (see setReloading), "OK N" with N being the number of changed options
+ *
+ * Errors are answered by "ERR MESSAGE".
+ *
+ * Only tunable options can be set; their values are stored atomically, so
+ *  that threads reading them are never blocked. For the same reason, a
+ *  reload may only change tunable options (see
+ *  OptionsTypedFileIO::reloadConfiguration); if the files change other
+ *  options, the reload fails and no option is changed.
+ *
+ * All connections are served by one thread using poll; connections may be
+ *  kept open for sending many requests. The socket is only accessible by
+ *  the process' user.
+ *
+ * The server is only available on systems that support Unix domain sockets.
+ */
+class OptionsControlServer {
+public:
+    /** @brief Constructor
+     * @param[in] options The options container to serve
+     */
+    OptionsControlServer(OptionsCont &options);
+
+
+    /// @brief Destructor, stops serving
+    ~OptionsControlServer();
+
+
+    /** @brief Enables the "reload" request
+     *
+     * The reader must not be used by other threads (e.g. an OptionsFileWatcher)
+     *  while the server runs.
+     * @param[in] reader The reader that has loaded the configuration
+     * @param[in] configOptionName The name of the option to get the path to the configuration to load from
+     */
+    void setReloading(OptionsTypedFileIO *reader, const std::string &configOptionName);
+
+
+    /** @brief Starts serving on an own thread
+     * @param[in] socketPath The path of the socket to create (an existing socket is replaced)
+     * @return Whether the socket could be opened
+     */
+    bool start(const std::string &socketPath);
+
+
+    /// @brief Stops serving, waits for the server's thread and removes the socket
+    void stop();
+
+
+    /** @brief Answers a single request
+     * @param[in] request The request line (without the line break)
+     * @return The answer (including line breaks), empty for empty requests
+     */
+    std::string process(const std::string &request);
+
+
+private:
+    /// @brief The server's main loop
+    void run();
+
+
+    /** @brief Reads the available data from a connection and answers complete requests
+     * @param[in] fd The connection's descriptor
+     * @return Whether the connection shall be kept open
+     */
+    bool readRequests(int fd);
+
+
+    /** @brief Writes pending answers to a connection
+     * @param[in] fd The connection's descriptor
+     * @return Whether the connection shall be kept open
+     */
+    bool writeAnswers(int fd);
+
+
+private:
+    /**
+     * @struct Connection
+     * @brief The buffers of an open connection
+     */
+    struct Connection {
+        /// @brief Received data not yet processed
+        std::string input;
+
+        /// @brief Answers not yet sent
+        std::string output;
+    };
+
+
+    /// @brief The options container to serve
+    OptionsCont &myOptions;
+
+    /// @brief The reader to reload the configuration with, 0 if reloading is disabled
+    OptionsTypedFileIO *myReader;
+
+    /// @brief The name of the option that names the configuration
+    std::string myConfigOptionName;
+
+    /// @brief The path of the socket
+    std::string mySocketPath;
+
+    /// @brief The listening socket
+    int myListenFD;
+
+    /// @brief The pipe used to stop the server's thread
+    int myStopPipe[2];
+
+    /// @brief The open connections by their descriptors
+    std::map<int, Connection> myConnections;
+
+    /// @brief The server's thread
+    std::thread myThread;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsControlServer(const OptionsControlServer &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsControlServer &operator=(const OptionsControlServer &s);
+
+
+};
+
+
+// *************************************************************************
+#endif
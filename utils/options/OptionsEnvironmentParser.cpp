@@ -0,0 +1,138 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsEnvironmentParser.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "OptionsCont.h"
+#include "OptionsEnvironmentParser.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * external definitions
+ * ======================================================================= */
+#if !defined _MSC_VER && !defined __BORLANDC__
+extern char **environ;
+#endif
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+bool
+OptionsEnvironmentParser::parse(OptionsCont &into, const std::string &prefix, char **env) {
+    if(env==0) {
+#if defined _MSC_VER || defined __BORLANDC__
+        env = _environ;
+#else
+        env = environ;
+#endif
+    }
+    // build the hash of normalised names; ambiguous ones map to an empty name
+    std::vector<std::string> names = into.getAllOptionNames();
+    std::unordered_map<std::string, std::string> normalised;
+    normalised.reserve(names.size()*2);
+    for(std::vector<std::string>::const_iterator i=names.begin(); i!=names.end(); ++i) {
+        if((*i).length()<2) {
+            continue;
+        }
+        std::string key = normalise(*i);
+        std::unordered_map<std::string, std::string>::iterator j = normalised.find(key);
+        if(j==normalised.end()) {
+            normalised[key] = *i;
+        } else if((*j).second!="" && into.getOptionID((*j).second)!=into.getOptionID(*i)) {
+            (*j).second = "";
+        }
+    }
+    // scan the environment once
+    bool ok = true;
+    std::string key;
+    for(char **e=env; e!=0 && *e!=0; ++e) {
+        const char *entry = *e;
+        if(strncmp(entry, prefix.c_str(), prefix.length())!=0) {
+            continue;
+        }
+        const char *name = entry + prefix.length();
+        const char *eq = strchr(name, '=');
+        if(eq==0 || eq==name) {
+            continue;
+        }
+        key.assign(name, eq-name);
+        std::unordered_map<std::string, std::string>::const_iterator j = normalised.find(key);
+        if(j==normalised.end()) {
+            continue;
+        }
+        const std::string &optionName = (*j).second;
+        if(optionName=="") {
+            std::cerr << "Error: The environment variable '" << prefix << key << "' matches more than one option." << std::endl;
+            ok = false;
+            continue;
+        }
+        if(!into.canBeSet(optionName)) {
+            continue;
+        }
+        try {
+            into.set(optionName, std::string(eq+1));
+        } catch(std::runtime_error &ex) {
+            throw std::runtime_error("Could not set option '" + optionName + "' from environment variable '" + prefix + key + "'; reason: " + ex.what());
+        }
+    }
+    return ok;
+}
+
+
+std::string
+OptionsEnvironmentParser::normalise(const std::string &name) {
+    std::string ret = name;
+    for(size_t i=0; i<ret.length(); ++i) {
+        char c = ret[i];
+        if(c>='a'&&c<='z') {
+            ret[i] = (char) (c - ('a'-'A'));
+        } else if(!((c>='A'&&c<='Z') || (c>='0'&&c<='9'))) {
+            ret[i] = '_';
+        }
+    }
+    return ret;
+}
+
+
+// *************************************************************************
@@ -0,0 +1,88 @@
+#ifndef OptionsEnvironmentParser_h
+#define OptionsEnvironmentParser_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsEnvironmentParser.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class OptionsCont;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsEnvironmentParser
+ * @brief Static helpers for reading options from environment variables.
+ *
+ * A variable is assigned to an option if its name consists of the given
+ *  prefix followed by the option's normalised name. An option name is
+ *  normalised by converting it to upper case and replacing all characters
+ *  that are neither letters nor digits by '_'. Using the prefix "MYAPP_",
+ *  the option "cache-size" is read from the variable "MYAPP_CACHE_SIZE".
+ *  Abbreviations (single-character names) are not considered.
+ *
+ * Only options that can be set are set. When used by OptionsIO::parseAndLoad,
+ *  the environment is read after the command line and before the configuration
+ *  files, so that the command line overrides the environment, which in turn
+ *  overrides the configuration files.
+ */
+class OptionsEnvironmentParser {
+public:
+    /** @brief Sets options from matching environment variables
+     *
+     * The environment is scanned once; the variables' names are matched
+     *  against a hash of the normalised option names.
+     * @param[in] into The options container to fill
+     * @param[in] prefix The prefix of the variables to consider
+     * @param[in] env The environment to read (0-terminated list of "NAME=value"), the process' environment if 0
+     * @return Whether all matching variables could be applied
+     * @throw runtime_error If a variable's value could not be set
+     */
+    static bool parse(OptionsCont &into, const std::string &prefix, char **env=0);
+
+
+    /** @brief Returns the normalised version of an option name
+     * @param[in] name The option name to normalise
+     * @return The normalised name (upper case, non-alphanumerical characters replaced by '_')
+     */
+    static std::string normalise(const std::string &name);
+
+
+};
+
+
+// *************************************************************************
+#endif
@@ -20,8 +20,11 @@
 /* =========================================================================
  * included modules
  * ======================================================================= */
+#include "Option.h"
 #include "OptionsCont.h"
+#include "OptionsParsedConfiguration.h"
 #include "OptionsFileIO_CSV.h"
+#include "OptionsFileWriter.h"
 #include <iostream>
 #include <fstream>
 #include <string>
@@ -54,41 +57,66 @@ OptionsFileIO_CSV::~OptionsFileIO_CSV() {
 
 
 bool
-OptionsFileIO_CSV::_loadConfiguration(OptionsCont &into, const std::string &configFileName) {
+OptionsFileIO_CSV::_parseConfiguration(const std::string &configFileName, OptionsParsedConfiguration &into) {
     std::string line;
     std::ifstream fdi(configFileName.c_str());
     if(!fdi.good()) {
         std::cerr << std::endl << "Error: Could not open configuration file '" << configFileName << "' for reading." << std::endl;
         return false;
     }
+    into.setUnknownAreErrors(true);
     while (getline(fdi, line, '\n')) {
-        // trim
-        do {
-            size_t l = line.length();
-            if(l==0) {
-                break;
-            }
-            char c = line.at(l-1);
-            if(c==' '||c=='\r'||c=='\n') {
-                line = line.substr(0, l-1);
-            } else {
-                break;
-            }
-        } while(true);
+        trimLineEnd(line);
         //
         size_t i1 = line.find(";");
         if(i1==std::string::npos) {
             continue;
         }
         std::string name = line.substr(0, i1);
-        if(name!="" && into.canBeSet(name)) {
+        std::string value;
+        if(i1+1<line.length() && line[i1+1]=='"') {
+            // quoted value; may contain dividers, quotes (doubled), and line breaks
+            size_t pos = i1 + 2;
+            bool closed = false;
+            while(!closed) {
+                size_t q = line.find('"', pos);
+                if(q==std::string::npos) {
+                    value += line.substr(pos);
+                    if(!getline(fdi, line, '\n')) {
+                        break;
+                    }
+                    if(line.length()!=0 && line[line.length()-1]=='\r') {
+                        line = line.substr(0, line.length()-1);
+                    }
+                    value += '\n';
+                    pos = 0;
+                } else if(q+1<line.length() && line[q+1]=='"') {
+                    value += line.substr(pos, q-pos+1);
+                    pos = q + 2;
+                } else {
+                    value += line.substr(pos, q-pos);
+                    closed = true;
+                }
+            }
+            if(!closed) {
+                std::cerr << std::endl << "Error: Unterminated quoted value of option '" << name << "' in '" << configFileName << "'." << std::endl;
+                return false;
+            }
+        } else {
+            // the trailing spaces of unquoted values are not significant
+            while(line.length()!=0 && line[line.length()-1]==' ') {
+                line = line.substr(0, line.length()-1);
+            }
             size_t i2 = line.find(";", i1+1);
             if(i2==std::string::npos) {
-                into.set(name, line.substr(i1+1));
+                value = line.substr(i1+1);
             } else {
-                into.set(name, line.substr(i1+1, i2-i1-1));
+                value = line.substr(i1+1, i2-i1-1);
             }
         }
+        if(name!="") {
+            into.add(name, value);
+        }
     }
     return true;
 }
@@ -96,29 +124,37 @@ OptionsFileIO_CSV::_loadConfiguration(OptionsCont &into, const std::string &conf
 
 bool
 OptionsFileIO_CSV::writeXMLConfiguration(const std::string &configName, const OptionsCont &options) {
-    std::vector<std::string> optionNames = options.getSortedOptionNames();
-    std::ofstream fdo(configName.c_str());
-    for(std::vector<std::string>::const_iterator i=optionNames.begin(); i!=optionNames.end(); ++i) {
-        std::string optionName = *i;
-        if(options.isSet(optionName) && !options.isDefault(optionName)) {
-            fdo << optionName << ";" << options.getValueAsString(optionName) << std::endl;
-        }
+    OptionsFileWriter writer;
+    OptionsBitset given = options.getNonDefaultOptions();
+    for(size_t i=given.findNext(0); i<given.size(); i=given.findNext(i+1)) {
+        writer.append(options.getOptionNameAt(i));
+        writer.append(';');
+        writer.appendCSVEscaped(options.getOptionAt(i).getValueAsString());
+        writer.append('\n');
     }
-    fdo.close();
-    return true;
+    return writer.writeAtomically(configName);
 }
 
 
 bool
 OptionsFileIO_CSV::writeXMLTemplate(const std::string &configName, const OptionsCont &options) {
-    std::vector<std::string> optionNames = options.getSortedOptionNames();
-    std::ofstream fdo(configName.c_str());
-    for(std::vector<std::string>::const_iterator i=optionNames.begin(); i!=optionNames.end(); ++i) {
-        std::string optionName = *i;
-        fdo << optionName << ";" << std::endl;
+    OptionsFileWriter writer;
+    size_t num = options.getOptionNumber();
+    for(size_t i=0; i<num; ++i) {
+        writer.append(options.getOptionNameAt(i));
+        writer.append(";\n");
     }
-    fdo.close();
-    return true;
+    return writer.writeAtomically(configName);
+}
+
+
+void
+OptionsFileIO_CSV::trimLineEnd(std::string &line) {
+    size_t l = line.length();
+    while(l!=0 && (line[l-1]=='\r'||line[l-1]=='\n')) {
+        --l;
+    }
+    line.resize(l);
 }
 
 
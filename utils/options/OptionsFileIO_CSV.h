@@ -21,6 +21,7 @@
 /* =========================================================================
  * included modules
  * ======================================================================= */
+#include <string>
 #include "OptionsTypedFileIO.h"
 
 /* -------------------------------------------------------------------
@@ -35,6 +36,7 @@
  * class declarations
  * ======================================================================= */
 class OptionsCont;
+class OptionsParsedConfiguration;
 
 
 /* =========================================================================
@@ -70,12 +72,19 @@ public:
 
 
 protected:
-    /** @brief Loads options from a configuration file
-     * @param[in] into The options container to fill
-     * @param[in] configurationName The path to the configuration to load
-     * @return Whether options could be loaded
+    /** @brief Parses a configuration file
+     * @param[in] configurationName The path to the configuration to parse
+     * @param[out] into The parsed configuration to fill
+     * @return Whether the file could be parsed
      */
-    bool _loadConfiguration(OptionsCont &into, const std::string &configurationName);
+    bool _parseConfiguration(const std::string &configurationName, OptionsParsedConfiguration &into);
+
+
+private:
+    /** @brief Removes line break characters from the end of the given line
+     * @param[in, out] line The line to trim
+     */
+    static void trimLineEnd(std::string &line);
 
 };
 
@@ -0,0 +1,604 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsFileIO_INI.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstring>
+#include <sstream>
+#include "Option.h"
+#include "OptionsCont.h"
+#include "OptionsFileIO_INI.h"
+#include "OptionsFileWriter.h"
+#include "OptionsMappedFile.h"
+#include "OptionsParsedConfiguration.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsINIScanner
+ * @brief A line-oriented scanner for INI / TOML-like configurations
+ *
+ * The bodies of sections are not scanned when the file is read; they are
+ *  kept as raw sections and scanned only if a container knows the section
+ *  (see OptionsParsedConfiguration::addRawSection and scanSection).
+ *
+ * Errors within a section do not stop the scan; they are stored with the
+ *  section and the rest of the section is skipped. They are reported only
+ *  if the application knows the section when the configuration is applied.
+ */
+class OptionsINIScanner {
+public:
+    /** @brief Constructor
+     * @param[in] data The begin of the contents to scan
+     * @param[in] size The size of the contents to scan
+     * @param[in] into The parsed configuration to fill
+     * @param[in] fileName The name of the scanned file (for reporting)
+     * @param[in] line The line the contents start at
+     */
+    OptionsINIScanner(const char *data, size_t size, OptionsParsedConfiguration &into, const std::string &fileName, size_t line=1)
+        : myPos(data), myEnd(data+size), myLine(line), myConfiguration(into), myFileName(fileName),
+          myAmInSection(false) {
+    }
+
+
+    /** @brief Scans the contents
+     * @return Whether the contents could be scanned
+     */
+    bool scan() {
+        while(true) {
+            skipBlanks();
+            if(myPos==myEnd) {
+                return true;
+            }
+            char c = *myPos;
+            if(c=='\n' || c=='\r' || c=='#' || c==';') {
+                skipLine();
+            } else if(c=='[') {
+                if(!scanHeader()) {
+                    report();
+                    return false;
+                }
+                const char *body = myPos;
+                size_t line = myLine;
+                skipSectionBody();
+                myConfiguration.addRawSection(mySection, body, myPos-body, line);
+            } else if(!scanKeyValue()) {
+                if(!myAmInSection) {
+                    report();
+                    return false;
+                }
+                myConfiguration.addSectionError(myError);
+                skipLine();
+                skipSectionBody();
+            }
+        }
+    }
+
+
+    /** @brief Scans the body of a section kept as a raw section
+     * @param[in] section The name of the section
+     */
+    void scanSection(const std::string &section) {
+        mySection = section;
+        myAmInSection = true;
+        myConfiguration.beginSection(section);
+        scan();
+    }
+
+
+private:
+    /** @brief Scans a section header; myPos is located at '['
+     * @return Whether the header could be scanned
+     */
+    bool scanHeader() {
+        ++myPos;
+        skipBlanks();
+        mySection.clear();
+        myAmInSection = true;
+        if(myPos!=myEnd && *myPos=='[') {
+            return error("arrays of tables are not supported");
+        }
+        if(myPos!=myEnd && (*myPos=='"' || *myPos=='\'')) {
+            if(!scanQuoted(mySection)) {
+                return false;
+            }
+            skipBlanks();
+        } else {
+            const char *beg = myPos;
+            while(myPos!=myEnd && *myPos!=']' && *myPos!='\n') {
+                ++myPos;
+            }
+            const char *end = myPos;
+            while(end!=beg && (end[-1]==' ' || end[-1]=='\t')) {
+                --end;
+            }
+            mySection.assign(beg, end-beg);
+        }
+        if(myPos==myEnd || *myPos!=']') {
+            return error("expected ']'");
+        }
+        ++myPos;
+        return finishLine();
+    }
+
+
+    /// @brief Skips lines until the next section header
+    void skipSectionBody() {
+        while(myPos!=myEnd) {
+            const char *p = myPos;
+            while(p!=myEnd && (*p==' ' || *p=='\t')) {
+                ++p;
+            }
+            if(p!=myEnd && *p=='[') {
+                return;
+            }
+            skipLine();
+        }
+    }
+
+
+    /** @brief Scans a "key = value" line
+     * @return Whether the line could be scanned
+     */
+    bool scanKeyValue() {
+        myKey.clear();
+        if(*myPos=='"' || *myPos=='\'') {
+            if(!scanQuoted(myKey)) {
+                return false;
+            }
+        } else {
+            const char *beg = myPos;
+            while(myPos!=myEnd && *myPos!='=' && *myPos!=' ' && *myPos!='\t' && *myPos!='\n' && *myPos!='\r') {
+                ++myPos;
+            }
+            myKey.assign(beg, myPos-beg);
+        }
+        skipBlanks();
+        if(myPos==myEnd || *myPos!='=') {
+            return error("expected '='");
+        }
+        ++myPos;
+        skipBlanks();
+        myValue.clear();
+        if(atLineEnd()) {
+            // no value given
+            return finishLine();
+        }
+        if(*myPos=='[') {
+            ++myPos;
+            bool first = true;
+            while(true) {
+                skipSpace();
+                if(myPos==myEnd) {
+                    return error("unterminated array");
+                }
+                if(*myPos==']') {
+                    ++myPos;
+                    break;
+                }
+                if(!first) {
+                    myValue.push_back(',');
+                }
+                first = false;
+                if(!scanScalar(myValue, true)) {
+                    return false;
+                }
+                skipSpace();
+                if(myPos!=myEnd && *myPos==',') {
+                    ++myPos;
+                } else if(myPos==myEnd || *myPos!=']') {
+                    return error("expected ',' or ']'");
+                }
+            }
+        } else if(!scanScalar(myValue, false)) {
+            return false;
+        }
+        if(!finishLine()) {
+            return false;
+        }
+        return apply();
+    }
+
+
+    /** @brief Scans a quoted or bare value and appends it
+     * @param[out] into The string to append the value to
+     * @param[in] inArray Whether the value is an array element
+     * @return Whether the value could be scanned
+     */
+    bool scanScalar(std::string &into, bool inArray) {
+        if(*myPos=='"' || *myPos=='\'') {
+            return scanQuoted(into);
+        }
+        const char *beg = myPos;
+        while(myPos!=myEnd && *myPos!='\n' && *myPos!='\r') {
+            char c = *myPos;
+            if(inArray && (c==',' || c==']' || c==' ' || c=='\t')) {
+                break;
+            }
+            if((c=='#' || c==';') && myPos!=beg && (myPos[-1]==' ' || myPos[-1]=='\t')) {
+                break;
+            }
+            ++myPos;
+        }
+        const char *end = myPos;
+        while(end!=beg && (end[-1]==' ' || end[-1]=='\t')) {
+            --end;
+        }
+        if(end==beg) {
+            return error("expected a value");
+        }
+        into.append(beg, end-beg);
+        return true;
+    }
+
+
+    /** @brief Scans a quoted string and appends its contents
+     *
+     * Double-quoted strings may contain escapes, single-quoted are taken literally.
+     * @param[out] into The string to append the contents to
+     * @return Whether the string could be scanned
+     */
+    bool scanQuoted(std::string &into) {
+        char quote = *myPos++;
+        while(myPos!=myEnd && *myPos!=quote && *myPos!='\n') {
+            if(*myPos!='\\' || quote=='\'') {
+                into.push_back(*myPos++);
+                continue;
+            }
+            ++myPos;
+            if(myPos==myEnd) {
+                break;
+            }
+            char c = *myPos++;
+            switch(c) {
+            case '"': into.push_back('"'); break;
+            case '\\': into.push_back('\\'); break;
+            case 'b': into.push_back('\b'); break;
+            case 'f': into.push_back('\f'); break;
+            case 'n': into.push_back('\n'); break;
+            case 'r': into.push_back('\r'); break;
+            case 't': into.push_back('\t'); break;
+            case 'u': {
+                unsigned int cp = 0;
+                for(int i=0; i<4; ++i) {
+                    char h = myPos!=myEnd ? *myPos++ : 0;
+                    cp <<= 4;
+                    if(h>='0'&&h<='9') {
+                        cp += h - '0';
+                    } else if(h>='a'&&h<='f') {
+                        cp += h - 'a' + 10;
+                    } else if(h>='A'&&h<='F') {
+                        cp += h - 'A' + 10;
+                    } else {
+                        return error("invalid unicode escape");
+                    }
+                }
+                if(cp<0x80) {
+                    into.push_back((char) cp);
+                } else if(cp<0x800) {
+                    into.push_back((char) (0xC0 | (cp>>6)));
+                    into.push_back((char) (0x80 | (cp&0x3F)));
+                } else {
+                    into.push_back((char) (0xE0 | (cp>>12)));
+                    into.push_back((char) (0x80 | ((cp>>6)&0x3F)));
+                    into.push_back((char) (0x80 | (cp&0x3F)));
+                }
+                break;
+            }
+            default:
+                return error("invalid escape sequence");
+            }
+        }
+        if(myPos==myEnd || *myPos!=quote) {
+            return error("unterminated string");
+        }
+        ++myPos;
+        return true;
+    }
+
+
+    /** @brief Returns whether the rest of the line is empty or a comment
+     * @return Whether the line ends at the current position
+     */
+    bool atLineEnd() const {
+        return myPos==myEnd || *myPos=='\n' || *myPos=='\r' || *myPos=='#' || *myPos==';';
+    }
+
+
+    /** @brief Skips the rest of the line which must be empty or a comment
+     * @return Whether only blanks or a comment followed
+     */
+    bool finishLine() {
+        skipBlanks();
+        if(!atLineEnd()) {
+            return error("unexpected characters at the end of the line");
+        }
+        skipLine();
+        return true;
+    }
+
+
+    /// @brief Skips the rest of the line including the line break
+    void skipLine() {
+        const char *nl = (const char*) memchr(myPos, '\n', myEnd-myPos);
+        if(nl==0) {
+            myPos = myEnd;
+        } else {
+            myPos = nl + 1;
+            ++myLine;
+        }
+    }
+
+
+    /// @brief Skips spaces and tabs
+    void skipBlanks() {
+        while(myPos!=myEnd && (*myPos==' ' || *myPos=='\t')) {
+            ++myPos;
+        }
+    }
+
+
+    /// @brief Skips white space, line breaks and comments (within arrays)
+    void skipSpace() {
+        while(myPos!=myEnd) {
+            char c = *myPos;
+            if(c=='#') {
+                skipLine();
+            } else if(c=='\n') {
+                ++myLine;
+                ++myPos;
+            } else if(c==' ' || c=='\t' || c=='\r') {
+                ++myPos;
+            } else {
+                return;
+            }
+        }
+    }
+
+
+    /** @brief Stores the scanned value for the option named myKey
+     * @return Always true
+     */
+    bool apply() {
+        myConfiguration.add(myKey, myValue);
+        return true;
+    }
+
+
+    /** @brief Remembers an error
+     * @param[in] msg The error message
+     * @return Always false
+     */
+    bool error(const char *msg) {
+        std::ostringstream s;
+        s << "Error: " << msg << " in '" << myFileName << "', line " << myLine << ".";
+        myError = s.str();
+        return false;
+    }
+
+
+    /// @brief Reports the last error
+    void report() {
+        std::cerr << std::endl << myError << std::endl;
+    }
+
+
+private:
+    /// @brief The current position
+    const char *myPos;
+
+    /// @brief The end of the contents
+    const char *myEnd;
+
+    /// @brief The current line
+    size_t myLine;
+
+    /// @brief The parsed configuration to fill
+    OptionsParsedConfiguration &myConfiguration;
+
+    /// @brief The name of the scanned file
+    const std::string &myFileName;
+
+    /// @brief Whether a section header was read
+    bool myAmInSection;
+
+    /// @brief The current section
+    std::string mySection;
+
+    /// @brief The currently processed key
+    std::string myKey;
+
+    /// @brief The currently processed value
+    std::string myValue;
+
+    /// @brief The last error
+    std::string myError;
+
+
+private:
+    /// @brief Invalidated assignment operator
+    OptionsINIScanner &operator=(const OptionsINIScanner &s);
+
+
+};
+
+
+
+/* =========================================================================
+ * static helper definitions
+ * ======================================================================= */
+/** @brief Scans the body of a raw section (see OptionsParsedConfiguration::SectionScanner)
+ * @param[in] section The name of the section
+ * @param[in] data The begin of the section's body
+ * @param[in] size The size of the section's body
+ * @param[in] line The line the body starts at
+ * @param[in] fileName The name of the file the section was read from
+ * @param[out] into The configuration to add the section's entries and errors to
+ */
+static void
+scanINISection(const std::string &section, const char *data, size_t size, size_t line,
+               const std::string &fileName, OptionsParsedConfiguration &into) {
+    OptionsINIScanner scanner(data, size, into, fileName, line);
+    scanner.scanSection(section);
+}
+
+
+/** @brief Appends a key or section name, quoted if it is not a plain word
+ * @param[out] writer The writer to append the name to
+ * @param[in] name The name to append
+ */
+static void
+appendININame(OptionsFileWriter &writer, const std::string &name) {
+    bool bare = name.length()!=0;
+    for(size_t i=0; i<name.length()&&bare; ++i) {
+        char c = name[i];
+        bare = (c>='a'&&c<='z') || (c>='A'&&c<='Z') || (c>='0'&&c<='9') || c=='_' || c=='-';
+    }
+    if(bare) {
+        writer.append(name);
+    } else {
+        writer.append('"');
+        writer.appendJSONEscaped(name);
+        writer.append('"');
+    }
+}
+
+
+/** @brief Writes the options sorted by sections
+ * @param[in] configName The name of the file to write
+ * @param[in] options The options to write
+ * @param[in] withValues Whether set values shall be written (or a template)
+ * @return Whether the file could be written
+ */
+static bool
+writeINI(const std::string &configName, const OptionsCont &options, bool withValues) {
+    // group the options by sections; options that are not within a section come first
+    std::map<std::string, std::vector<size_t> > bySection;
+    if(withValues) {
+        OptionsBitset given = options.getNonDefaultOptions();
+        for(size_t i=given.findNext(0); i<given.size(); i=given.findNext(i+1)) {
+            bySection[options.getSectionAt(i)].push_back(i);
+        }
+    } else {
+        size_t num = options.getOptionNumber();
+        for(size_t i=0; i<num; ++i) {
+            bySection[options.getSectionAt(i)].push_back(i);
+        }
+    }
+    std::vector<std::string> sections;
+    sections.push_back("");
+    sections.insert(sections.end(), options.getSections().begin(), options.getSections().end());
+    OptionsFileWriter writer;
+    for(std::vector<std::string>::const_iterator i=sections.begin(); i!=sections.end(); ++i) {
+        std::map<std::string, std::vector<size_t> >::const_iterator j = bySection.find(*i);
+        if(j==bySection.end() || ((*i)=="" && i!=sections.begin())) {
+            continue;
+        }
+        if((*i)!="") {
+            if(writer.getContents().length()!=0) {
+                writer.append('\n');
+            }
+            writer.append('[');
+            appendININame(writer, *i);
+            writer.append("]\n");
+        }
+        for(std::vector<size_t>::const_iterator k=(*j).second.begin(); k!=(*j).second.end(); ++k) {
+            const Option &option = options.getOptionAt(*k);
+            appendININame(writer, options.getOptionNameAt(*k));
+            writer.append(" =");
+            if(!withValues) {
+                writer.append('\n');
+                continue;
+            }
+            writer.append(' ');
+            if(dynamic_cast<const Option_Integer*>(&option)!=0 || dynamic_cast<const Option_Double*>(&option)!=0 || dynamic_cast<const Option_Bool*>(&option)!=0 || option.isTunable()) {
+                writer.append(option.getValueAsString());
+            } else {
+                // TOML basic strings use the same escapes as JSON strings
+                writer.append('"');
+                writer.appendJSONEscaped(option.getValueAsString());
+                writer.append('"');
+            }
+            writer.append('\n');
+        }
+    }
+    return writer.writeAtomically(configName);
+}
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+OptionsFileIO_INI::OptionsFileIO_INI() {
+}
+
+
+OptionsFileIO_INI::~OptionsFileIO_INI() {
+}
+
+
+bool
+OptionsFileIO_INI::_parseConfiguration(const std::string &configFileName, OptionsParsedConfiguration &into) {
+    OptionsMappedFile file;
+    if(!file.open(configFileName)) {
+        std::cerr << std::endl << "Error: Could not open configuration file '" << configFileName << "' for reading." << std::endl;
+        return false;
+    }
+    into.setSectionScanner(&scanINISection);
+    OptionsINIScanner scanner(file.getData(), file.getSize(), into, configFileName);
+    return scanner.scan();
+}
+
+
+bool
+OptionsFileIO_INI::writeXMLConfiguration(const std::string &configName, const OptionsCont &options) {
+    return writeINI(configName, options, true);
+}
+
+
+bool
+OptionsFileIO_INI::writeXMLTemplate(const std::string &configName, const OptionsCont &options) {
+    return writeINI(configName, options, false);
+}
+
+
+// *************************************************************************
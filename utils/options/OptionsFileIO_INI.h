@@ -0,0 +1,102 @@
+#ifndef OptionsFileIO_INI_h
+#define OptionsFileIO_INI_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsFileIO_INI.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include "OptionsTypedFileIO.h"
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class OptionsCont;
+class OptionsParsedConfiguration;
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsFileIO_INI
+ * @brief A base class for loading/saving options from/to INI / TOML-like files
+ *
+ * The configuration consists of "key = value" lines which are grouped into
+ *  sections using "[section]" headers. The sections are the ones begun
+ *  using OptionsCont::beginSection; a key within a section is only
+ *  resolved against the options of this section. Keys given before the
+ *  first header are resolved against all options.
+ *
+ * Values may be bare (numbers, booleans, plain text), quoted using double
+ *  quotes (with escapes) or single quotes (literal), or arrays of such
+ *  values ("[a, b]") which are given to the option as a comma-separated list.
+ *  '#' and ';' start comments. Keys without a value are skipped.
+ *
+ * Options of sections the options container does not know are skipped, as
+ *  well as syntax errors within them.
+ */
+class OptionsFileIO_INI : public OptionsTypedFileIO {
+public:
+    /// @brief Constructor
+    OptionsFileIO_INI();
+
+
+    /// @brief Destructor
+    ~OptionsFileIO_INI();
+
+
+    /** @brief Writes the set options as an INI configuration file
+     * @param[in] configName The name of the file to write the configuration to
+     * @param[in] options The options container that includes the (set/parsed) options to write
+     */
+    bool writeXMLConfiguration(const std::string &configName, const OptionsCont &options);
+
+
+    /** @brief Writes the a template for a configuration file
+     *
+     * All options are written without a value.
+     * @param configName The name of the file to write the template to
+     * @param options The options container to write a template for
+     * @throws IOException If the file cannot be written
+     */
+    bool writeXMLTemplate(const std::string &configName, const OptionsCont &options);
+
+
+protected:
+    /** @brief Parses a configuration file
+     * @param[in] configurationName The path to the configuration to parse
+     * @param[out] into The parsed configuration to fill
+     * @return Whether the file could be parsed
+     */
+    bool _parseConfiguration(const std::string &configurationName, OptionsParsedConfiguration &into);
+
+};
+
+
+// *************************************************************************
+#endif
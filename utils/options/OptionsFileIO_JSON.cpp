@@ -0,0 +1,483 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsFileIO_JSON.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <iostream>
+#include <string>
+#include <cstring>
+#include "Option.h"
+#include "OptionsCont.h"
+#include "OptionsFileIO_JSON.h"
+#include "OptionsFileWriter.h"
+#include "OptionsMappedFile.h"
+#include "OptionsParsedConfiguration.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsJSONScanner
+ * @brief A single-pass JSON scanner that stores the name/value pairs it reads
+ *
+ * The scanner keeps the dotted name of the currently processed value only;
+ *  no document tree is built.
+ */
+class OptionsJSONScanner {
+public:
+    /** @brief Constructor
+     * @param[in] data The begin of the contents to scan
+     * @param[in] size The size of the contents to scan
+     * @param[in] into The parsed configuration to fill
+     * @param[in] fileName The name of the scanned file (for reporting)
+     */
+    OptionsJSONScanner(const char *data, size_t size, OptionsParsedConfiguration &into, const std::string &fileName)
+        : myBegin(data), myPos(data), myEnd(data+size), myConfiguration(into), myFileName(fileName) {
+        myName.reserve(256);
+        myValue.reserve(256);
+    }
+
+
+    /** @brief Scans the contents
+     * @return Whether the contents could be scanned
+     */
+    bool scan() {
+        skipWhitespace();
+        if(myPos==myEnd || *myPos!='{') {
+            return error("expected an object");
+        }
+        if(!scanObject()) {
+            return false;
+        }
+        skipWhitespace();
+        if(myPos!=myEnd) {
+            return error("unexpected content after the configuration object");
+        }
+        return true;
+    }
+
+
+private:
+    /** @brief Scans an object; myPos is located at '{'
+     * @return Whether the object could be scanned
+     */
+    bool scanObject() {
+        size_t prefixLength = myName.length();
+        ++myPos;
+        skipWhitespace();
+        if(myPos!=myEnd && *myPos=='}') {
+            ++myPos;
+            return true;
+        }
+        while(true) {
+            skipWhitespace();
+            if(myPos==myEnd || *myPos!='"') {
+                return error("expected a member name");
+            }
+            if(prefixLength!=0) {
+                myName.push_back('.');
+            }
+            if(!scanString(myName)) {
+                return false;
+            }
+            skipWhitespace();
+            if(myPos==myEnd || *myPos!=':') {
+                return error("expected ':'");
+            }
+            ++myPos;
+            skipWhitespace();
+            if(!scanMemberValue()) {
+                return false;
+            }
+            myName.resize(prefixLength);
+            skipWhitespace();
+            if(myPos==myEnd) {
+                return error("unterminated object");
+            }
+            if(*myPos==',') {
+                ++myPos;
+                continue;
+            }
+            if(*myPos=='}') {
+                ++myPos;
+                return true;
+            }
+            return error("expected ',' or '}'");
+        }
+    }
+
+
+    /** @brief Scans the value of the member named myName and stores it
+     * @return Whether the value could be scanned
+     */
+    bool scanMemberValue() {
+        if(myPos==myEnd) {
+            return error("expected a value");
+        }
+        if(*myPos=='{') {
+            return scanObject();
+        }
+        myValue.clear();
+        if(*myPos=='[') {
+            ++myPos;
+            skipWhitespace();
+            if(myPos!=myEnd && *myPos==']') {
+                ++myPos;
+                return apply();
+            }
+            while(true) {
+                skipWhitespace();
+                bool isNull = false;
+                if(!scanScalar(myValue, isNull)) {
+                    return false;
+                }
+                skipWhitespace();
+                if(myPos==myEnd) {
+                    return error("unterminated array");
+                }
+                if(*myPos==']') {
+                    ++myPos;
+                    return apply();
+                }
+                if(*myPos!=',') {
+                    return error("expected ',' or ']'");
+                }
+                myValue.push_back(',');
+                ++myPos;
+            }
+        }
+        bool isNull = false;
+        if(!scanScalar(myValue, isNull)) {
+            return false;
+        }
+        return isNull ? true : apply();
+    }
+
+
+    /** @brief Scans a string, number, or literal and appends its text
+     * @param[out] into The string to append the value's text to
+     * @param[out] isNull Set to true if the value is null
+     * @return Whether the value could be scanned
+     */
+    bool scanScalar(std::string &into, bool &isNull) {
+        if(myPos==myEnd) {
+            return error("expected a value");
+        }
+        char c = *myPos;
+        if(c=='"') {
+            return scanString(into);
+        }
+        if(c=='{' || c=='[') {
+            return error("nested objects and arrays are not supported within arrays");
+        }
+        if(matchLiteral("true")) {
+            into.append("true");
+            return true;
+        }
+        if(matchLiteral("false")) {
+            into.append("false");
+            return true;
+        }
+        if(matchLiteral("null")) {
+            isNull = true;
+            return true;
+        }
+        const char *beg = myPos;
+        while(myPos!=myEnd && ((*myPos>='0'&&*myPos<='9') || *myPos=='-' || *myPos=='+' || *myPos=='.' || *myPos=='e' || *myPos=='E')) {
+            ++myPos;
+        }
+        if(beg==myPos) {
+            return error("expected a value");
+        }
+        into.append(beg, myPos-beg);
+        return true;
+    }
+
+
+    /** @brief Scans a string and appends its (unescaped) contents; myPos is located at '"'
+     * @param[out] into The string to append the contents to
+     * @return Whether the string could be scanned
+     */
+    bool scanString(std::string &into) {
+        ++myPos;
+        while(true) {
+            // plain runs are copied at once; memchr is vectorised by the C library
+            const char *quote = (const char*) memchr(myPos, '"', myEnd-myPos);
+            if(quote==0) {
+                return error("unterminated string");
+            }
+            const char *escape = (const char*) memchr(myPos, '\\', quote-myPos);
+            if(escape==0) {
+                into.append(myPos, quote-myPos);
+                myPos = quote + 1;
+                return true;
+            }
+            into.append(myPos, escape-myPos);
+            myPos = escape + 1;
+            if(myPos==myEnd) {
+                return error("unterminated string");
+            }
+            char c = *myPos++;
+            switch(c) {
+            case '"': into.push_back('"'); break;
+            case '\\': into.push_back('\\'); break;
+            case '/': into.push_back('/'); break;
+            case 'b': into.push_back('\b'); break;
+            case 'f': into.push_back('\f'); break;
+            case 'n': into.push_back('\n'); break;
+            case 'r': into.push_back('\r'); break;
+            case 't': into.push_back('\t'); break;
+            case 'u': {
+                unsigned int cp = 0;
+                if(!scanHex4(cp)) {
+                    return false;
+                }
+                if(cp>=0xD800 && cp<0xDC00) {
+                    // surrogate pair
+                    unsigned int low = 0;
+                    if(myEnd-myPos<2 || myPos[0]!='\\' || myPos[1]!='u') {
+                        return error("invalid surrogate pair");
+                    }
+                    myPos += 2;
+                    if(!scanHex4(low) || low<0xDC00 || low>=0xE000) {
+                        return error("invalid surrogate pair");
+                    }
+                    cp = 0x10000 + ((cp-0xD800)<<10) + (low-0xDC00);
+                }
+                appendUTF8(into, cp);
+                break;
+            }
+            default:
+                return error("invalid escape sequence");
+            }
+        }
+    }
+
+
+    /** @brief Scans four hexadecimal digits
+     * @param[out] into The scanned value
+     * @return Whether the digits could be scanned
+     */
+    bool scanHex4(unsigned int &into) {
+        if(myEnd-myPos<4) {
+            return error("invalid unicode escape");
+        }
+        for(int i=0; i<4; ++i) {
+            char c = *myPos++;
+            into <<= 4;
+            if(c>='0'&&c<='9') {
+                into += c - '0';
+            } else if(c>='a'&&c<='f') {
+                into += c - 'a' + 10;
+            } else if(c>='A'&&c<='F') {
+                into += c - 'A' + 10;
+            } else {
+                return error("invalid unicode escape");
+            }
+        }
+        return true;
+    }
+
+
+    /** @brief Appends the given code point UTF-8 encoded
+     * @param[out] into The string to append the code point to
+     * @param[in] cp The code point to append
+     */
+    static void appendUTF8(std::string &into, unsigned int cp) {
+        if(cp<0x80) {
+            into.push_back((char) cp);
+        } else if(cp<0x800) {
+            into.push_back((char) (0xC0 | (cp>>6)));
+            into.push_back((char) (0x80 | (cp&0x3F)));
+        } else if(cp<0x10000) {
+            into.push_back((char) (0xE0 | (cp>>12)));
+            into.push_back((char) (0x80 | ((cp>>6)&0x3F)));
+            into.push_back((char) (0x80 | (cp&0x3F)));
+        } else {
+            into.push_back((char) (0xF0 | (cp>>18)));
+            into.push_back((char) (0x80 | ((cp>>12)&0x3F)));
+            into.push_back((char) (0x80 | ((cp>>6)&0x3F)));
+            into.push_back((char) (0x80 | (cp&0x3F)));
+        }
+    }
+
+
+    /** @brief Consumes the given literal if it follows
+     * @param[in] literal The literal to match
+     * @return Whether the literal was found (and consumed)
+     */
+    bool matchLiteral(const char *literal) {
+        size_t len = strlen(literal);
+        if((size_t) (myEnd-myPos)<len || memcmp(myPos, literal, len)!=0) {
+            return false;
+        }
+        myPos += len;
+        return true;
+    }
+
+
+    /// @brief Skips white space
+    void skipWhitespace() {
+        while(myPos!=myEnd && (*myPos==' '||*myPos=='\n'||*myPos=='\r'||*myPos=='\t')) {
+            ++myPos;
+        }
+    }
+
+
+    /** @brief Stores the scanned value for the option named myName
+     * @return Always true
+     */
+    bool apply() {
+        myConfiguration.add(myName, myValue);
+        return true;
+    }
+
+
+    /** @brief Reports an error
+     * @param[in] msg The error message
+     * @return Always false
+     */
+    bool error(const char *msg) {
+        size_t line = 1;
+        for(const char *p=myBegin; p<myPos && p<myEnd; ++p) {
+            if(*p=='\n') {
+                ++line;
+            }
+        }
+        std::cerr << std::endl << "Error: " << msg << " in '" << myFileName << "', line " << line << "." << std::endl;
+        return false;
+    }
+
+
+private:
+    /// @brief The begin of the contents
+    const char *myBegin;
+
+    /// @brief The current position
+    const char *myPos;
+
+    /// @brief The end of the contents
+    const char *myEnd;
+
+    /// @brief The parsed configuration to fill
+    OptionsParsedConfiguration &myConfiguration;
+
+    /// @brief The name of the scanned file
+    const std::string &myFileName;
+
+    /// @brief The (dotted) name of the currently processed member
+    std::string myName;
+
+    /// @brief The value of the currently processed member
+    std::string myValue;
+
+
+private:
+    /// @brief Invalidated assignment operator
+    OptionsJSONScanner &operator=(const OptionsJSONScanner &s);
+
+
+};
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+OptionsFileIO_JSON::OptionsFileIO_JSON() {
+}
+
+
+OptionsFileIO_JSON::~OptionsFileIO_JSON() {
+}
+
+
+bool
+OptionsFileIO_JSON::_parseConfiguration(const std::string &configFileName, OptionsParsedConfiguration &into) {
+    OptionsMappedFile file;
+    if(!file.open(configFileName)) {
+        std::cerr << std::endl << "Error: Could not open configuration file '" << configFileName << "' for reading." << std::endl;
+        return false;
+    }
+    OptionsJSONScanner scanner(file.getData(), file.getSize(), into, configFileName);
+    return scanner.scan();
+}
+
+
+bool
+OptionsFileIO_JSON::writeXMLConfiguration(const std::string &configName, const OptionsCont &options) {
+    OptionsFileWriter writer;
+    writer.append('{');
+    bool first = true;
+    OptionsBitset given = options.getNonDefaultOptions();
+    for(size_t i=given.findNext(0); i<given.size(); i=given.findNext(i+1)) {
+        const Option &option = options.getOptionAt(i);
+        writer.append(first ? "\n    \"" : ",\n    \"");
+        first = false;
+        writer.appendJSONEscaped(options.getOptionNameAt(i));
+        writer.append("\": ");
+        std::string value = option.getValueAsString();
+        Option::ValueKind kind = option.getValueKind();
+        // non-finite numbers ("inf", "nan") are no JSON numbers and are written as strings
+        if(kind==Option::VALUE_BOOL || (kind!=Option::VALUE_STRING && value.length()!=0 && value.find_first_not_of("0123456789+-.eE")==std::string::npos)) {
+            writer.append(value);
+        } else {
+            writer.append('"');
+            writer.appendJSONEscaped(value);
+            writer.append('"');
+        }
+    }
+    writer.append("\n}\n");
+    return writer.writeAtomically(configName);
+}
+
+
+bool
+OptionsFileIO_JSON::writeXMLTemplate(const std::string &configName, const OptionsCont &options) {
+    OptionsFileWriter writer;
+    writer.append('{');
+    size_t num = options.getOptionNumber();
+    for(size_t i=0; i<num; ++i) {
+        writer.append(i==0 ? "\n    \"" : ",\n    \"");
+        writer.appendJSONEscaped(options.getOptionNameAt(i));
+        writer.append("\": null");
+    }
+    writer.append("\n}\n");
+    return writer.writeAtomically(configName);
+}
+
+
+// *************************************************************************
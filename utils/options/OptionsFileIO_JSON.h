@@ -0,0 +1,95 @@
+#ifndef OptionsFileIO_JSON_h
+#define OptionsFileIO_JSON_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsFileIO_JSON.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include "OptionsTypedFileIO.h"
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class OptionsCont;
+class OptionsParsedConfiguration;
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsFileIO_JSON
+ * @brief A base class for loading/saving options from/to JSON files
+ *
+ * The configuration is a JSON object. Nested objects are mapped onto
+ *  dotted option names ({"a": {"b": 1}} sets the option "a.b"), arrays
+ *  of scalar values are given to the option as a comma-separated list.
+ *  null values are skipped.
+ *
+ * The file is scanned in a single pass without building a document tree.
+ */
+class OptionsFileIO_JSON : public OptionsTypedFileIO {
+public:
+    /// @brief Constructor
+    OptionsFileIO_JSON();
+
+
+    /// @brief Destructor
+    ~OptionsFileIO_JSON();
+
+
+    /** @brief Writes the set options as a JSON configuration file
+     * @param[in] configName The name of the file to write the configuration to
+     * @param[in] options The options container that includes the (set/parsed) options to write
+     */
+    bool writeXMLConfiguration(const std::string &configName, const OptionsCont &options);
+
+
+    /** @brief Writes the a template for a configuration file
+     *
+     * All options are written with a null value.
+     * @param configName The name of the file to write the template to
+     * @param options The options container to write a template for
+     * @throws IOException If the file cannot be written
+     */
+    bool writeXMLTemplate(const std::string &configName, const OptionsCont &options);
+
+
+protected:
+    /** @brief Parses a configuration file
+     * @param[in] configurationName The path to the configuration to parse
+     * @param[out] into The parsed configuration to fill
+     * @return Whether the file could be parsed
+     */
+    bool _parseConfiguration(const std::string &configurationName, OptionsParsedConfiguration &into);
+
+};
+
+
+// *************************************************************************
+#endif
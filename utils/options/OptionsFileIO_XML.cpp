@@ -37,7 +37,10 @@
 #include <string>
 #include "OptionsXercesHandler.h"
 #include "OptionsFileIO_XML.h"
+#include "OptionsFileWriter.h"
 #include "OptionsCont.h"
+#include "OptionsParsedConfiguration.h"
+#include "Option.h"
 
 /* -------------------------------------------------------------------------
  * (optional) memory checking
@@ -56,6 +59,33 @@ using namespace XERCES_CPP_NAMESPACE;
 
 
 
+/* =========================================================================
+ * static helper definitions
+ * ======================================================================= */
+/** @brief Initialises xerces once per process
+ *
+ * Files may be parsed in parallel (see setPrefetchParents) and xerces'
+ *  initialisation and termination are not reentrant, so xerces is
+ *  initialised by the first parse (the initialisation of the static is
+ *  thread-safe) and stays initialised until the process ends.
+ * @return Whether xerces could be initialised
+ */
+static bool
+initXerces() {
+    static const bool initialised = []() {
+        try {
+            XMLPlatformUtils::Initialize();
+        } catch(const XMLException& toCatch) {
+            cerr << "Error during initialization! Message:" << std::endl << OptionsXercesHandler::convert(toCatch.getMessage()) << endl;
+            return false;
+        }
+        return true;
+    }();
+    return initialised;
+}
+
+
+
 /* =========================================================================
  * method definitions
  * ======================================================================= */
@@ -68,12 +98,9 @@ OptionsFileIO_XML::~OptionsFileIO_XML() {
 
 
 bool
-OptionsFileIO_XML::_loadConfiguration(OptionsCont &into, const std::string &configFileName) {
+OptionsFileIO_XML::_parseConfiguration(const std::string &configFileName, OptionsParsedConfiguration &into) {
 #ifdef USE_XERCES_XML
-    try {
-        XMLPlatformUtils::Initialize();
-    } catch(const XMLException& toCatch) {
-        cerr << "Error during initialization! Message:" << std::endl << OptionsXercesHandler::convert(toCatch.getMessage()) << endl;
+    if(!initXerces()) {
         return false;
     }
     SAX2XMLReader* parser = XMLReaderFactory::createXMLReader();
@@ -86,17 +113,18 @@ OptionsFileIO_XML::_loadConfiguration(OptionsCont &into, const std::string &conf
         std::cerr << std::endl << "Error during parsing: '" << configFileName << "'." << std::endl
             << "Exception message is:" << std::endl
             << OptionsXercesHandler::convert(e.getMessage()) << std::endl;
-        XMLPlatformUtils::Terminate();
+        delete parser;
         return false;
     } catch(...) {
         std::cerr << std::endl << "Error: Unexpected exception during parsing: '" << configFileName << "':" << std::endl;
-        XMLPlatformUtils::Terminate();
+        delete parser;
         return false;
     }
+    delete parser;
     return !handler.errorOccured();
 #else
     // consume "into"
-    into.contains("foo");
+    into.getEntryNumber();
     return true;
 #endif // USE_XERCES_XML
 }
@@ -104,33 +132,39 @@ OptionsFileIO_XML::_loadConfiguration(OptionsCont &into, const std::string &conf
 
 bool
 OptionsFileIO_XML::writeXMLConfiguration(const std::string &configName, const OptionsCont &options) {
-    std::vector<std::string> optionNames = options.getSortedOptionNames();
-    std::ofstream fdo(configName.c_str());
-    fdo << "<configuration>" << std::endl;
-    for(std::vector<std::string>::const_iterator i=optionNames.begin(); i!=optionNames.end(); ++i) {
-        std::string optionName = *i;
-        if(options.isSet(optionName) && !options.isDefault(optionName)) {
-            fdo << "   <" << optionName << ">" << options.getValueAsString(optionName) << "</" << optionName << std::endl;
-        }
+    OptionsFileWriter writer;
+    writer.append("<configuration>\n");
+    OptionsBitset given = options.getNonDefaultOptions();
+    for(size_t i=given.findNext(0); i<given.size(); i=given.findNext(i+1)) {
+        const std::string &optionName = options.getOptionNameAt(i);
+        writer.append("   <");
+        writer.append(optionName);
+        writer.append('>');
+        writer.appendXMLEscaped(options.getOptionAt(i).getValueAsString());
+        writer.append("</");
+        writer.append(optionName);
+        writer.append(">\n");
     }
-    fdo << "</configuration>" << std::endl;
-    fdo.close();
-    return true;
+    writer.append("</configuration>\n");
+    return writer.writeAtomically(configName);
 }
 
 
 bool
 OptionsFileIO_XML::writeXMLTemplate(const std::string &configName, const OptionsCont &options) {
-    std::vector<std::string> optionNames = options.getSortedOptionNames();
-    std::ofstream fdo(configName.c_str());
-    fdo << "<configuration>" << std::endl;
-    for(std::vector<std::string>::const_iterator i=optionNames.begin(); i!=optionNames.end(); ++i) {
-        std::string optionName = *i;
-        fdo << "   <" << optionName << "></" << optionName << std::endl;
+    OptionsFileWriter writer;
+    writer.append("<configuration>\n");
+    size_t num = options.getOptionNumber();
+    for(size_t i=0; i<num; ++i) {
+        const std::string &optionName = options.getOptionNameAt(i);
+        writer.append("   <");
+        writer.append(optionName);
+        writer.append("></");
+        writer.append(optionName);
+        writer.append(">\n");
     }
-    fdo << "</configuration>" << std::endl;
-    fdo.close();
-    return true;
+    writer.append("</configuration>\n");
+    return writer.writeAtomically(configName);
 }
 
 
@@ -0,0 +1,314 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsFileWatcher.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <algorithm>
+#include <cerrno>
+#ifdef __linux__
+#include <unistd.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#endif
+#include "OptionsBatchScope.h"
+#include "OptionsCont.h"
+#include "OptionsTypedFileIO.h"
+#include "OptionsChangeListener.h"
+#include "OptionsMappedFile.h"
+#include "OptionsHash.h"
+#include "OptionsFileWatcher.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+OptionsFileWatcher::OptionsFileWatcher(OptionsCont &options, OptionsTypedFileIO &reader, const std::string &configOptionName)
+    : myOptions(options), myReader(reader), myConfigOptionName(configOptionName), myDebounceTime(100), myNotifyFD(-1) {
+    myStopPipe[0] = myStopPipe[1] = -1;
+    // remember the loaded files' hashes, so that reloadIfChanged works without start
+    updateWatches();
+}
+
+
+OptionsFileWatcher::~OptionsFileWatcher() {
+    stop();
+}
+
+
+void
+OptionsFileWatcher::setDebounceTime(int milliseconds) {
+    myDebounceTime = milliseconds;
+}
+
+
+void
+OptionsFileWatcher::addListener(OptionsChangeListener *listener) {
+    std::lock_guard<std::mutex> lock(myListenersLock);
+    myListeners.push_back(listener);
+}
+
+
+void
+OptionsFileWatcher::removeListener(OptionsChangeListener *listener) {
+    std::lock_guard<std::mutex> lock(myListenersLock);
+    myListeners.erase(std::remove(myListeners.begin(), myListeners.end(), listener), myListeners.end());
+}
+
+
+bool
+OptionsFileWatcher::start() {
+#ifdef __linux__
+    if(myThread.joinable()) {
+        return true;
+    }
+    myNotifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if(myNotifyFD<0) {
+        std::cerr << std::endl << "Error: Could not initialise inotify." << std::endl;
+        return false;
+    }
+    if(pipe(myStopPipe)!=0) {
+        std::cerr << std::endl << "Error: Could not create the watcher's pipe." << std::endl;
+        close(myNotifyFD);
+        myNotifyFD = -1;
+        return false;
+    }
+    if(!updateWatches()) {
+        std::cerr << std::endl << "Error: Could not read the configuration files to watch." << std::endl;
+        stop();
+        return false;
+    }
+    myThread = std::thread(&OptionsFileWatcher::run, this);
+    return true;
+#else
+    std::cerr << std::endl << "Error: Watching configuration files is not supported on this platform." << std::endl;
+    return false;
+#endif
+}
+
+
+void
+OptionsFileWatcher::stop() {
+#ifdef __linux__
+    if(myThread.joinable()) {
+        // the thread polls the descriptors closed below; it has to be left first
+        char c = 0;
+        ssize_t written;
+        do {
+            written = write(myStopPipe[1], &c, 1);
+        } while(written<0 && errno==EINTR);
+        myThread.join();
+    }
+    for(int i=0; i<2; ++i) {
+        if(myStopPipe[i]>=0) {
+            close(myStopPipe[i]);
+            myStopPipe[i] = -1;
+        }
+    }
+    if(myNotifyFD>=0) {
+        close(myNotifyFD);
+        myNotifyFD = -1;
+    }
+    myWatchedFiles.clear();
+#endif
+}
+
+
+bool
+OptionsFileWatcher::reloadIfChanged() {
+    bool contentChanged = false;
+    if(!readHashes(contentChanged) || !contentChanged) {
+        return false;
+    }
+    return reload();
+}
+
+
+bool
+OptionsFileWatcher::readHashes(bool &changed) {
+    changed = false;
+    for(std::map<std::string, unsigned long long>::const_iterator i=myHashes.begin(); i!=myHashes.end(); ++i) {
+        unsigned long long hash;
+        if(!hashFile((*i).first, hash)) {
+            return false;
+        }
+        changed |= hash!=(*i).second;
+    }
+    return true;
+}
+
+
+bool
+OptionsFileWatcher::reload() {
+    std::vector<size_t> changed;
+    {
+        // only tunable options may change, so that readers are never blocked;
+        //  subscribers get the changes at once after the reload
+        OptionsBatchScope batch(myOptions);
+        try {
+            myReader.reloadConfiguration(myOptions, myConfigOptionName, changed, true);
+        } catch(std::runtime_error &e) {
+            std::cerr << std::endl << "Error: " << e.what() << std::endl;
+        }
+    }
+    updateWatches();
+    if(changed.empty()) {
+        return false;
+    }
+    std::vector<OptionsChangeListener*> listeners;
+    {
+        std::lock_guard<std::mutex> lock(myListenersLock);
+        listeners = myListeners;
+    }
+    for(std::vector<OptionsChangeListener*>::iterator i=listeners.begin(); i!=listeners.end(); ++i) {
+        (*i)->optionsChanged(myOptions, changed);
+    }
+    return true;
+}
+
+
+void
+OptionsFileWatcher::run() {
+#ifdef __linux__
+    const int eventMask = IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE;
+    bool pending = false;
+    std::chrono::steady_clock::time_point deadline;
+    // inotify events are aligned like their header
+    alignas(inotify_event) char buffer[4096];
+    while(true) {
+        int timeout = -1;
+        if(pending) {
+            std::chrono::milliseconds rest = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            timeout = rest.count()>0 ? (int) rest.count() : 0;
+        }
+        struct pollfd fds[2];
+        fds[0].fd = myNotifyFD;
+        fds[0].events = POLLIN;
+        fds[0].revents = 0;
+        fds[1].fd = myStopPipe[0];
+        fds[1].events = POLLIN;
+        fds[1].revents = 0;
+        int ret = poll(fds, 2, timeout);
+        if(fds[1].revents!=0) {
+            return;
+        }
+        if(ret>0 && (fds[0].revents&POLLIN)!=0) {
+            ssize_t length;
+            while((length=read(myNotifyFD, buffer, sizeof(buffer)))>0) {
+                for(char *p=buffer; p<buffer+length; ) {
+                    const inotify_event *event = (const inotify_event*) p;
+                    p += sizeof(inotify_event) + event->len;
+                    if((event->mask&eventMask)==0 || event->len==0) {
+                        continue;
+                    }
+                    std::map<int, std::set<std::string> >::const_iterator i = myWatchedFiles.find(event->wd);
+                    if(i!=myWatchedFiles.end() && (*i).second.find(event->name)!=(*i).second.end()) {
+                        // (re)start the debounce window
+                        pending = true;
+                        deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(myDebounceTime);
+                    }
+                }
+            }
+        }
+        if(pending && std::chrono::steady_clock::now()>=deadline) {
+            bool contentChanged = false;
+            if(!readHashes(contentChanged)) {
+                // a file is probably being replaced; check again after the debounce time
+                deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(myDebounceTime);
+            } else {
+                pending = false;
+                if(contentChanged) {
+                    reload();
+                }
+            }
+        }
+    }
+#endif
+}
+
+
+bool
+OptionsFileWatcher::updateWatches() {
+    bool ok = true;
+    myHashes.clear();
+    const std::vector<std::string> &files = myReader.getLoadedFiles();
+    for(std::vector<std::string>::const_iterator i=files.begin(); i!=files.end(); ++i) {
+        unsigned long long hash = 0;
+        ok &= hashFile(*i, hash);
+        myHashes[*i] = hash;
+    }
+#ifdef __linux__
+    if(myNotifyFD>=0) {
+        for(std::map<int, std::set<std::string> >::const_iterator i=myWatchedFiles.begin(); i!=myWatchedFiles.end(); ++i) {
+            inotify_rm_watch(myNotifyFD, (*i).first);
+        }
+        myWatchedFiles.clear();
+        for(std::vector<std::string>::const_iterator i=files.begin(); i!=files.end(); ++i) {
+            size_t pos = (*i).rfind('/');
+            std::string dir = pos==std::string::npos ? "." : (pos==0 ? "/" : (*i).substr(0, pos));
+            std::string name = pos==std::string::npos ? *i : (*i).substr(pos+1);
+            int wd = inotify_add_watch(myNotifyFD, dir.c_str(), IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE);
+            if(wd<0) {
+                ok = false;
+                continue;
+            }
+            myWatchedFiles[wd].insert(name);
+        }
+    }
+#endif
+    return ok;
+}
+
+
+bool
+OptionsFileWatcher::hashFile(const std::string &fileName, unsigned long long &hash) {
+    OptionsMappedFile file;
+    if(!file.open(fileName)) {
+        return false;
+    }
+    hash = OptionsHash::fnv1a(file.getData(), file.getSize());
+    return true;
+}
+
+
+// *************************************************************************
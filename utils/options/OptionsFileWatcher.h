@@ -0,0 +1,213 @@
+#ifndef OptionsFileWatcher_h
+#define OptionsFileWatcher_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsFileWatcher.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <mutex>
+#include <thread>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class OptionsCont;
+class OptionsTypedFileIO;
+class OptionsChangeListener;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsFileWatcher
+ * @brief Reloads the configuration if one of its files changes
+ *
+ * The watcher observes all files read by the last call to the reader's
+ *  loadConfiguration method (the configuration and its parents). It watches
+ *  the files' directories using inotify, so that files replaced by editors
+ *  (written to a temporary file and renamed) are noticed as well.
+ *
+ * Bursts of events are coalesced: the files are checked once no further
+ *  event arrived within the debounce time. The configuration is reloaded
+ *  (see OptionsTypedFileIO::reloadConfiguration) only if the content hash
+ *  of a file has changed; the listeners are then informed about the
+ *  options whose values have changed. Listeners subscribed at the options
+ *  container (see OptionsCont::subscribe) receive the reload's changes as
+ *  one batch.
+ *
+ * The reload and the listener calls are performed on the watcher's thread.
+ *  Only tunable options may be changed by a reload (see
+ *  OptionsTypedFileIO::reloadConfiguration), so that threads reading the
+ *  options are never blocked; a reload that would change other options is
+ *  reported and leaves all options unchanged. If a file cannot be read
+ *  (e.g. while it is being replaced), the files are checked again after
+ *  the debounce time. The reader must not be used by other threads while
+ *  the watcher runs.
+ *
+ * Watching is only available on Linux; on other systems, reloadIfChanged
+ *  may be called periodically instead.
+ */
+class OptionsFileWatcher {
+public:
+    /** @brief Constructor
+     *
+     * Remembers the files loaded by the reader and their content hashes.
+     * @param[in] options The options container to reload
+     * @param[in] reader The reader that has loaded the configuration
+     * @param[in] configOptionName The name of the option to get the path to the configuration to load from
+     */
+    OptionsFileWatcher(OptionsCont &options, OptionsTypedFileIO &reader, const std::string &configOptionName);
+
+
+    /// @brief Destructor, stops watching
+    ~OptionsFileWatcher();
+
+
+    /** @brief Sets the time to wait for further events before checking the files
+     * @param[in] milliseconds The debounce time in milliseconds (default: 100)
+     */
+    void setDebounceTime(int milliseconds);
+
+
+    /** @brief Registers a listener that is informed about changed options
+     * @param[in] listener The listener to add (not owned)
+     */
+    void addListener(OptionsChangeListener *listener);
+
+
+    /** @brief Removes a registered listener
+     * @param[in] listener The listener to remove
+     */
+    void removeListener(OptionsChangeListener *listener);
+
+
+    /** @brief Starts watching the loaded files on an own thread
+     * @return Whether watching could be started
+     */
+    bool start();
+
+
+    /// @brief Stops watching and waits for the watcher's thread
+    void stop();
+
+
+    /** @brief Reloads the configuration if the content of one of its files has changed
+     *
+     * Must not be called while the watcher's thread runs.
+     * @return Whether the values of options have changed
+     */
+    bool reloadIfChanged();
+
+
+private:
+    /// @brief The watcher's main loop
+    void run();
+
+
+    /** @brief Computes the hashes of the watched files and compares them to the remembered ones
+     * @param[out] changed Whether the content of a file has changed
+     * @return Whether all files could be read
+     */
+    bool readHashes(bool &changed);
+
+
+    /** @brief Reloads the configuration and informs the listeners
+     * @return Whether the values of options have changed
+     */
+    bool reload();
+
+
+    /** @brief Remembers the loaded files and their hashes and (re-)registers the watches
+     * @return Whether all files could be read
+     */
+    bool updateWatches();
+
+
+    /** @brief Computes the hash of a file's contents
+     * @param[in] fileName The name of the file
+     * @param[out] hash The hash of the file's contents
+     * @return Whether the file could be read
+     */
+    static bool hashFile(const std::string &fileName, unsigned long long &hash);
+
+
+private:
+    /// @brief The options container to reload
+    OptionsCont &myOptions;
+
+    /// @brief The reader that has loaded the configuration
+    OptionsTypedFileIO &myReader;
+
+    /// @brief The name of the option that names the configuration
+    std::string myConfigOptionName;
+
+    /// @brief The debounce time in milliseconds
+    int myDebounceTime;
+
+    /// @brief The listeners
+    std::vector<OptionsChangeListener*> myListeners;
+
+    /// @brief A lock for the listeners
+    std::mutex myListenersLock;
+
+    /// @brief The watched files and their content hashes
+    std::map<std::string, unsigned long long> myHashes;
+
+    /// @brief The names of the watched files by the descriptor of their directory's watch
+    std::map<int, std::set<std::string> > myWatchedFiles;
+
+    /// @brief The inotify descriptor
+    int myNotifyFD;
+
+    /// @brief The pipe used to stop the watcher's thread
+    int myStopPipe[2];
+
+    /// @brief The watcher's thread
+    std::thread myThread;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsFileWatcher(const OptionsFileWatcher &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsFileWatcher &operator=(const OptionsFileWatcher &s);
+
+
+};
+
+
+// *************************************************************************
+#endif
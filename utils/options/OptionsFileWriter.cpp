@@ -0,0 +1,248 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsFileWriter.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <iostream>
+#include <sstream>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#if defined _MSC_VER || defined __BORLANDC__
+#include <io.h>
+#include <process.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "OptionsFileWriter.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+OptionsFileWriter::OptionsFileWriter(size_t reserve) {
+    myContents.reserve(reserve);
+}
+
+
+OptionsFileWriter::~OptionsFileWriter() {
+}
+
+
+void
+OptionsFileWriter::append(const std::string &str) {
+    myContents.append(str);
+}
+
+
+void
+OptionsFileWriter::append(const char *str) {
+    myContents.append(str);
+}
+
+
+void
+OptionsFileWriter::append(char c) {
+    myContents.push_back(c);
+}
+
+
+void
+OptionsFileWriter::appendXMLEscaped(const std::string &str) {
+    size_t beg = 0;
+    for(size_t i=0; i<str.length(); ++i) {
+        const char *entity = 0;
+        switch(str[i]) {
+        case '&': entity = "&amp;"; break;
+        case '<': entity = "&lt;"; break;
+        case '>': entity = "&gt;"; break;
+        case '"': entity = "&quot;"; break;
+        case '\'': entity = "&apos;"; break;
+        default: break;
+        }
+        if(entity!=0) {
+            myContents.append(str, beg, i-beg);
+            myContents.append(entity);
+            beg = i + 1;
+        }
+    }
+    myContents.append(str, beg, std::string::npos);
+}
+
+
+void
+OptionsFileWriter::appendCSVEscaped(const std::string &str) {
+    bool needsQuotes = str.find_first_of(";\"\r\n")!=std::string::npos;
+    if(!needsQuotes && str.length()!=0) {
+        // the reader trims trailing spaces, leading ones would look like an indent
+        needsQuotes = str[0]==' ' || str[str.length()-1]==' ';
+    }
+    if(!needsQuotes) {
+        myContents.append(str);
+        return;
+    }
+    myContents.push_back('"');
+    size_t beg = 0;
+    for(size_t i=str.find('"'); i!=std::string::npos; i=str.find('"', beg)) {
+        myContents.append(str, beg, i-beg+1);
+        myContents.push_back('"');
+        beg = i + 1;
+    }
+    myContents.append(str, beg, std::string::npos);
+    myContents.push_back('"');
+}
+
+
+void
+OptionsFileWriter::appendJSONEscaped(const std::string &str) {
+    static const char *hex = "0123456789abcdef";
+    size_t beg = 0;
+    for(size_t i=0; i<str.length(); ++i) {
+        unsigned char c = (unsigned char) str[i];
+        if(c!='"' && c!='\\' && c>=0x20) {
+            continue;
+        }
+        myContents.append(str, beg, i-beg);
+        beg = i + 1;
+        myContents.push_back('\\');
+        switch(c) {
+        case '"': myContents.push_back('"'); break;
+        case '\\': myContents.push_back('\\'); break;
+        case '\n': myContents.push_back('n'); break;
+        case '\r': myContents.push_back('r'); break;
+        case '\t': myContents.push_back('t'); break;
+        case '\b': myContents.push_back('b'); break;
+        case '\f': myContents.push_back('f'); break;
+        default:
+            myContents.append("u00");
+            myContents.push_back(hex[c>>4]);
+            myContents.push_back(hex[c&15]);
+            break;
+        }
+    }
+    myContents.append(str, beg, std::string::npos);
+}
+
+
+const std::string &
+OptionsFileWriter::getContents() const {
+    return myContents;
+}
+
+
+bool
+OptionsFileWriter::writeAtomically(const std::string &fileName) const {
+    // the temporary file is located in the same folder so that it can be renamed;
+    //  its name is unique per process and call, so that threads do not share it
+    static std::atomic<unsigned int> counter(0);
+    std::string tmpName;
+    int fd = -1;
+    for(int tries=0; fd<0 && tries<16; ++tries) {
+        std::ostringstream oss;
+#if defined _MSC_VER || defined __BORLANDC__
+        oss << fileName << ".~" << _getpid() << "." << counter++ << ".tmp";
+        tmpName = oss.str();
+        fd = _open(tmpName.c_str(), _O_WRONLY|_O_CREAT|_O_EXCL|_O_BINARY, _S_IREAD|_S_IWRITE);
+#else
+        oss << fileName << ".~" << getpid() << "." << counter++ << ".tmp";
+        tmpName = oss.str();
+        fd = open(tmpName.c_str(), O_WRONLY|O_CREAT|O_EXCL, 0666);
+#endif
+        if(fd<0 && errno!=EEXIST) {
+            break;
+        }
+    }
+    if(fd<0) {
+        std::cerr << std::endl << "Error: Could not open configuration file '" << tmpName << "' for writing." << std::endl;
+        return false;
+    }
+    bool ok = true;
+#if !defined _MSC_VER && !defined __BORLANDC__
+    // keep the permissions of the replaced file
+    struct stat st;
+    if(stat(fileName.c_str(), &st)==0) {
+        ok = fchmod(fd, st.st_mode & 07777)==0;
+    }
+#endif
+    const char *data = myContents.data();
+    size_t left = myContents.length();
+    while(ok && left>0) {
+#if defined _MSC_VER || defined __BORLANDC__
+        int written = _write(fd, data, (unsigned int) left);
+#else
+        ssize_t written = write(fd, data, left);
+#endif
+        if(written<=0) {
+            ok = false;
+        } else {
+            data += written;
+            left -= (size_t) written;
+        }
+    }
+#if defined _MSC_VER || defined __BORLANDC__
+    ok = ok && _commit(fd)==0;
+    ok = (_close(fd)==0) && ok;
+    ok = ok && MoveFileExA(tmpName.c_str(), fileName.c_str(), MOVEFILE_REPLACE_EXISTING|MOVEFILE_WRITE_THROUGH)!=0;
+#else
+    ok = ok && fsync(fd)==0;
+    ok = (close(fd)==0) && ok;
+    ok = ok && rename(tmpName.c_str(), fileName.c_str())==0;
+#endif
+    if(!ok) {
+        std::cerr << std::endl << "Error: Could not write configuration file '" << fileName << "'." << std::endl;
+        remove(tmpName.c_str());
+        return false;
+    }
+#if !defined _MSC_VER && !defined __BORLANDC__
+    // make the rename itself durable
+    size_t sep = fileName.rfind('/');
+    std::string dirName = sep==std::string::npos ? "." : fileName.substr(0, sep==0 ? 1 : sep);
+    int dfd = open(dirName.c_str(), O_RDONLY);
+    if(dfd>=0) {
+        fsync(dfd);
+        close(dfd);
+    }
+#endif
+    return true;
+}
+
+
+
+// *************************************************************************
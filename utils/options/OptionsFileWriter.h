@@ -0,0 +1,138 @@
+#ifndef OptionsFileWriter_h
+#define OptionsFileWriter_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsFileWriter.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsFileWriter
+ * @brief Collects a configuration file's contents in memory and writes it at once
+ *
+ * The configuration writers format their output into the buffer of this
+ *  class instead of writing (and flushing) each option into a stream.
+ *  The buffer is written into a temporary file which is synced to disk
+ *  and then renamed into the destination, so that readers either see the
+ *  old or the complete new configuration.
+ */
+class OptionsFileWriter {
+public:
+    /** @brief Constructor
+     * @param[in] reserve The number of bytes to preallocate
+     */
+    OptionsFileWriter(size_t reserve=65536);
+
+
+    /// @brief Destructor
+    ~OptionsFileWriter();
+
+
+    /** @brief Appends the given string unchanged
+     * @param[in] str The string to append
+     */
+    void append(const std::string &str);
+
+
+    /** @brief Appends the given string unchanged
+     * @param[in] str The (0-terminated) string to append
+     */
+    void append(const char *str);
+
+
+    /** @brief Appends the given character unchanged
+     * @param[in] c The character to append
+     */
+    void append(char c);
+
+
+    /** @brief Appends the given string, escaping XML special characters
+     *
+     * '&', '<', '>', '"' and ''' are replaced by the respective entities.
+     * @param[in] str The string to append
+     */
+    void appendXMLEscaped(const std::string &str);
+
+
+    /** @brief Appends the given string as a CSV field
+     *
+     * The field is enclosed in double quotes if it contains the divider (';'),
+     *  a double quote, a line break or leading / trailing spaces. Double quotes
+     *  within a quoted field are doubled.
+     * @param[in] str The string to append
+     */
+    void appendCSVEscaped(const std::string &str);
+
+
+    /** @brief Appends the given string, escaping it as a JSON string's contents
+     *
+     * '"', '\\' and control characters are escaped. The enclosing double
+     *  quotes are not written.
+     * @param[in] str The string to append
+     */
+    void appendJSONEscaped(const std::string &str);
+
+
+    /** @brief Returns the collected contents
+     * @return The contents collected so far
+     */
+    const std::string &getContents() const;
+
+
+    /** @brief Writes the collected contents into the named file
+     *
+     * The contents are written into a temporary file located next to the
+     *  destination (named uniquely per call), synced, and renamed into
+     *  place. An existing file's permissions are kept.
+     * @param[in] fileName The name of the file to write
+     * @return Whether the file could be written
+     */
+    bool writeAtomically(const std::string &fileName) const;
+
+
+private:
+    /// @brief The collected contents
+    std::string myContents;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsFileWriter(const OptionsFileWriter &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsFileWriter &operator=(const OptionsFileWriter &s);
+
+
+};
+
+
+// *************************************************************************
+#endif
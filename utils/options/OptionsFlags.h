@@ -0,0 +1,177 @@
+#ifndef OptionsFlags_h
+#define OptionsFlags_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsFlags.h
+   @since        19.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <deque>
+#include <atomic>
+#include <cstddef>
+#include "OptionsBitset.h"
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsFlags
+ * @brief The state flags of a container's options, stored as bitsets indexed by option ID
+ *
+ * Each option keeps its flags (see Option::isSet, Option::isDefault,
+ *  Option::canBeSet) and writes every change through to the flags of the
+ *  container it was added to, so that the container may answer which
+ *  options are set, given, or settable by reading a few words instead of
+ *  asking each option.
+ *
+ * The words are atomics so that options may be tuned while others are
+ *  set or the flags are read; they are kept in deques, which do not move
+ *  them when options are added.
+ */
+class OptionsFlags {
+public:
+    /// @brief The flags, given as bit indices
+    enum Flag {
+        /// @brief The option may be set
+        FLAG_SETABLE = 0,
+        /// @brief The option's value may be read
+        FLAG_SET = 1,
+        /// @brief The option's value is its default value
+        FLAG_DEFAULT = 2,
+        /// @brief The option or its section has subscribers (kept by the container only, see OptionsCont::subscribe)
+        FLAG_SUBSCRIBED = 3,
+        /// @brief The number of flags
+        FLAG_NUMBER = 4
+    };
+
+
+    /// @brief Constructor
+    OptionsFlags()
+        : mySize(0) {
+    }
+
+
+    /** @brief Adds cleared flags for further options
+     * @param[in] size The new number of options
+     */
+    void resize(size_t size) {
+        size_t words = (size+OptionsBitset::WORD_BITS-1)/OptionsBitset::WORD_BITS;
+        for(size_t flag=0; flag<FLAG_NUMBER; ++flag) {
+            while(myWords[flag].size()<words) {
+                myWords[flag].emplace_back(0ULL);
+            }
+        }
+        mySize = size;
+    }
+
+
+    /** @brief Stores an option's flags
+     * @param[in] id The ID of the option
+     * @param[in] flags The option's flags, a bit (1<<Flag) per set flag
+     */
+    void store(size_t id, unsigned char flags) {
+        size_t word = id/OptionsBitset::WORD_BITS;
+        unsigned long long bit = 1ULL<<(id%OptionsBitset::WORD_BITS);
+        // the options keep all flags but FLAG_SUBSCRIBED
+        for(size_t flag=0; flag<FLAG_SUBSCRIBED; ++flag) {
+            if((flags&(1<<flag))!=0) {
+                myWords[flag][word].fetch_or(bit, std::memory_order_relaxed);
+            } else {
+                myWords[flag][word].fetch_and(~bit, std::memory_order_relaxed);
+            }
+        }
+    }
+
+
+    /** @brief Sets a flag of an option
+     * @param[in] id The ID of the option
+     * @param[in] flag The flag to set
+     */
+    void set(size_t id, Flag flag) {
+        myWords[flag][id/OptionsBitset::WORD_BITS].fetch_or(1ULL<<(id%OptionsBitset::WORD_BITS), std::memory_order_relaxed);
+    }
+
+
+    /** @brief Clears a flag of an option
+     * @param[in] id The ID of the option
+     * @param[in] flag The flag to clear
+     */
+    void clear(size_t id, Flag flag) {
+        myWords[flag][id/OptionsBitset::WORD_BITS].fetch_and(~(1ULL<<(id%OptionsBitset::WORD_BITS)), std::memory_order_relaxed);
+    }
+
+
+    /** @brief Returns whether an option has a flag
+     * @param[in] id The ID of the option
+     * @param[in] flag The flag to test
+     * @return Whether the option has the flag
+     */
+    bool test(size_t id, Flag flag) const {
+        return (myWords[flag][id/OptionsBitset::WORD_BITS].load(std::memory_order_relaxed)&(1ULL<<(id%OptionsBitset::WORD_BITS)))!=0;
+    }
+
+
+    /** @brief Returns the options that have a flag but not another one
+     * @param[in] flag The flag the options must have
+     * @param[in] unless The flag the options must not have, FLAG_NUMBER for none
+     * @return The set of the options' IDs
+     */
+    OptionsBitset get(Flag flag, Flag unless=FLAG_NUMBER) const {
+        OptionsBitset ret(mySize);
+        for(size_t i=0; i<myWords[flag].size(); ++i) {
+            unsigned long long word = myWords[flag][i].load(std::memory_order_relaxed);
+            if(unless!=FLAG_NUMBER) {
+                word &= ~myWords[unless][i].load(std::memory_order_relaxed);
+            }
+            ret.setWord(i, word);
+        }
+        return ret;
+    }
+
+
+private:
+    /// @brief The words of each flag's bitset
+    std::deque<std::atomic<unsigned long long> > myWords[FLAG_NUMBER];
+
+    /// @brief The number of options
+    size_t mySize;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsFlags(const OptionsFlags &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsFlags &operator=(const OptionsFlags &s);
+
+
+};
+
+
+// *************************************************************************
+#endif
@@ -0,0 +1,153 @@
+#ifndef OptionsHandle_h
+#define OptionsHandle_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsHandle.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <stdexcept>
+#include "Option.h"
+#include "OptionsCont.h"
+#include "OptionsOverrideScope.h"
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsHandle
+ * @brief A typed reference to a single option
+ *
+ * The option is looked up once, when the handle is built; reading the
+ *  value does not need a name lookup. If the options are being loaded
+ *  (see OptionsIO::parseAndLoadAsync), reading blocks until loading has
+ *  finished. Values overridden for the reading thread (see
+ *  OptionsOverrideScope) take precedence.
+ *
+ * Use the typedefs OptionsIntegerHandle, OptionsDoubleHandle,
+ *  OptionsBoolHandle, OptionsStringHandle, and OptionsEnumHandle, or
+ *  OptionsTunableIntegerHandle and OptionsTunableDoubleHandle for tunable
+ *  options. Typed options (see
+ *  Option_Typed) are read using OptionsHandle<Option_TypedValue<T>, const T &>.
+ */
+template<class OptionType, typename ValueType>
+class OptionsHandle {
+public:
+    /** @brief Constructor
+     * @param[in] options The options container the option is stored in
+     * @param[in] name The name of the option
+     * @throw runtime_error If the option is not known or has a different type
+     */
+    OptionsHandle(const OptionsCont &options, const std::string &name)
+        : myOptions(options), myName(name), myOption(dynamic_cast<const OptionType*>(options.getOption(name))), myID(0) {
+        if(myOption==0) {
+            throw std::runtime_error("Option '" + name + "' has a different type than the handle.");
+        }
+        myID = options.getOptionID(name);
+    }
+
+
+    /** @brief Returns the option's value, waiting if the options are being loaded
+     * @return The option's value
+     * @throw runtime_error If the option is not set
+     */
+    ValueType get() const {
+        const OptionType *option = myOption;
+        if(OptionsOverrideScope::isActive()) {
+            // overrides are clones of the option, so they have its type
+            const Option *overriding = OptionsOverrideScope::find(myOptions, myID);
+            if(overriding!=0) {
+                option = static_cast<const OptionType*>(overriding);
+            }
+        }
+        myOptions.waitLoaded();
+        if(!option->isSet()) {
+            throw std::runtime_error("The option '" + myName + "' is not set!");
+        }
+        return option->getValue();
+    }
+
+
+    /** @brief Returns the option's value, waiting if the options are being loaded
+     * @return The option's value
+     */
+    operator ValueType() const {
+        return get();
+    }
+
+
+    /** @brief Returns the name the handle was built for
+     * @return The option's name
+     */
+    const std::string &getName() const {
+        return myName;
+    }
+
+
+private:
+    /// @brief The options container
+    const OptionsCont &myOptions;
+
+    /// @brief The name of the option
+    std::string myName;
+
+    /// @brief The option
+    const OptionType *myOption;
+
+    /// @brief The option's ID
+    size_t myID;
+
+
+};
+
+
+/// @brief A handle to an integer option
+typedef OptionsHandle<Option_Integer, int> OptionsIntegerHandle;
+
+/// @brief A handle to a double option
+typedef OptionsHandle<Option_Double, double> OptionsDoubleHandle;
+
+/// @brief A handle to a bool option
+typedef OptionsHandle<Option_Bool, bool> OptionsBoolHandle;
+
+/// @brief A handle to a tunable integer option (reading is a relaxed atomic load)
+typedef OptionsHandle<Option_TunableInteger, int> OptionsTunableIntegerHandle;
+
+/// @brief A handle to a tunable double option (reading is a relaxed atomic load)
+typedef OptionsHandle<Option_TunableDouble, double> OptionsTunableDoubleHandle;
+
+/// @brief A handle to an enum option (yields the value's code)
+typedef OptionsHandle<Option_Enum, int> OptionsEnumHandle;
+
+/// @brief A handle to a string (or file name) option
+typedef OptionsHandle<Option_String, const std::string &> OptionsStringHandle;
+
+
+// *************************************************************************
+#endif
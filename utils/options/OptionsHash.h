@@ -0,0 +1,84 @@
+#ifndef OptionsHash_h
+#define OptionsHash_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsHash.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <cstddef>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsHash
+ * @brief 64 bit FNV-1a hashing of file contents and values
+ *
+ * Used for detecting changes; not meant to be cryptographically safe.
+ */
+class OptionsHash {
+public:
+    /// @brief The FNV-1a offset basis (the hash of no data)
+    static const unsigned long long OFFSET_BASIS = 14695981039346656037ULL;
+
+    /// @brief The FNV-1a prime
+    static const unsigned long long PRIME = 1099511628211ULL;
+
+
+    /** @brief Hashes the given data
+     * @param[in] data The data to hash
+     * @param[in] length The length of the data
+     * @param[in] hash The hash to continue (OFFSET_BASIS to start a new one)
+     * @return The hash
+     */
+    static unsigned long long fnv1a(const char *data, size_t length, unsigned long long hash=OFFSET_BASIS) {
+        for(size_t i=0; i<length; ++i) {
+            hash ^= (unsigned char) data[i];
+            hash *= PRIME;
+        }
+        return hash;
+    }
+
+
+    /** @brief Hashes the given string
+     * @param[in] s The string to hash
+     * @param[in] hash The hash to continue (OFFSET_BASIS to start a new one)
+     * @return The hash
+     */
+    static unsigned long long fnv1a(const std::string &s, unsigned long long hash=OFFSET_BASIS) {
+        return fnv1a(s.data(), s.length(), hash);
+    }
+
+
+};
+
+
+// *************************************************************************
+#endif
@@ -20,7 +20,9 @@
 /* =========================================================================
  * included modules
  * ======================================================================= */
+#include "OptionsBatchScope.h"
 #include "OptionsCont.h"
+#include "OptionsEnvironmentParser.h"
 #include "OptionsIO.h"
 #include "OptionsParser.h"
 #include "OptionsTypedFileIO.h"
@@ -29,6 +31,7 @@
 #include <fstream>
 #include <string>
 #include <sstream>
+#include <future>
 
 /* -------------------------------------------------------------------------
  * (optional) memory checking
@@ -46,6 +49,43 @@ using namespace std;
 
 
 
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsLoadingScope
+ * @brief Declares the current thread as the loading one and ends loading when left
+ */
+class OptionsLoadingScope {
+public:
+    /** @brief Constructor
+     * @param[in] options The options being loaded
+     */
+    OptionsLoadingScope(OptionsCont &options) : myOptions(options) {
+        myOptions.claimLoading();
+    }
+
+
+    /// @brief Destructor, ends loading
+    ~OptionsLoadingScope() {
+        myOptions.endLoading();
+    }
+
+
+private:
+    /// @brief The options being loaded
+    OptionsCont &myOptions;
+
+
+private:
+    /// @brief Invalidated assignment operator
+    OptionsLoadingScope &operator=(const OptionsLoadingScope &s);
+
+
+};
+
+
+
 /* =========================================================================
  * method definitions
  * ======================================================================= */
@@ -53,26 +93,80 @@ bool
 OptionsIO::parseAndLoad(OptionsCont &into, int argc, char **argv,
                         OptionsTypedFileIO &fileIO, const std::string &configOptionName, 
                         bool , bool ) {
+    OptionsBatchScope batch(into);
     bool ok = OptionsParser::parse(into, argc, argv);
     if(ok && configOptionName.length()!=0 && into.isSet(configOptionName)) {
         ok = fileIO.loadConfiguration(into, configOptionName);
     }
+    if(ok) {
+        into.checkRules();
+    }
     return ok;
 }
 
 
+bool
+OptionsIO::parseAndLoad(OptionsCont &into, int argc, char **argv,
+                        const std::string &envPrefix, OptionsTypedFileIO &fileIO, const std::string &configOptionName,
+                        bool , bool ) {
+    OptionsBatchScope batch(into);
+    bool ok = OptionsParser::parse(into, argc, argv);
+    if(ok) {
+        ok = OptionsEnvironmentParser::parse(into, envPrefix);
+    }
+    if(ok && configOptionName.length()!=0 && into.isSet(configOptionName)) {
+        ok = fileIO.loadConfiguration(into, configOptionName);
+    }
+    if(ok) {
+        into.checkRules();
+    }
+    return ok;
+}
+
+
+std::shared_future<bool>
+OptionsIO::parseAndLoadAsync(OptionsCont &into, int argc, char **argv,
+                             OptionsTypedFileIO &fileIO, const std::string &configOptionName,
+                             bool continueOnError, bool acceptUnknown) {
+    into.beginLoading();
+    try {
+        return std::async(std::launch::async, [&into, argc, argv, &fileIO, configOptionName, continueOnError, acceptUnknown]() {
+            OptionsLoadingScope scope(into);
+            return parseAndLoad(into, argc, argv, fileIO, configOptionName, continueOnError, acceptUnknown);
+        }).share();
+    } catch(...) {
+        // the worker could not be started; release the readers
+        into.endLoading();
+        throw;
+    }
+}
+
+
+std::shared_future<bool>
+OptionsIO::parseAndLoadAsync(OptionsCont &into, int argc, char **argv,
+                             const std::string &envPrefix, OptionsTypedFileIO &fileIO, const std::string &configOptionName,
+                             bool continueOnError, bool acceptUnknown) {
+    into.beginLoading();
+    try {
+        return std::async(std::launch::async, [&into, argc, argv, envPrefix, &fileIO, configOptionName, continueOnError, acceptUnknown]() {
+            OptionsLoadingScope scope(into);
+            return parseAndLoad(into, argc, argv, envPrefix, fileIO, configOptionName, continueOnError, acceptUnknown);
+        }).share();
+    } catch(...) {
+        // the worker could not be started; release the readers
+        into.endLoading();
+        throw;
+    }
+}
+
+
 
 void 
 OptionsIO::printSetOptions(std::ostream &os, const OptionsCont &options, bool includeSynonyms, bool shortestFirst, bool skipDefault) {
-    std::vector<std::string> optionNames = options.getSortedOptionNames();
-    for(std::vector<std::string>::const_iterator i=optionNames.begin(); i!=optionNames.end(); ++i) {
-        std::string optionName = *i;
-        if(!options.isSet(optionName)) {
-            continue;
-        }
-        if(skipDefault && options.isDefault(optionName)) {
-            continue;
-        }
+    OptionsBitset toPrint = skipDefault ? options.getNonDefaultOptions() : options.getSetOptions();
+    for(size_t i=toPrint.findNext(0); i<toPrint.size(); i=toPrint.findNext(i+1)) {
+        const std::string &optionName = options.getOptionNameAt(i);
+        const Option &option = options.getOptionAt(i);
         std::vector<std::string> synonyms = options.getSynonyms(optionName);
         if(shortestFirst) {
             std::reverse(synonyms.begin(), synonyms.end());
@@ -91,8 +185,8 @@ OptionsIO::printSetOptions(std::ostream &os, const OptionsCont &options, bool in
                 os << ")";
             }
         }
-        os << ": " << options.getValueAsString(optionName);
-        if(options.isDefault(optionName)) {
+        os << ": " << option.getValueAsString();
+        if(option.isDefault()) {
             os << " (default)";
         }
         os << std::endl;
@@ -145,6 +239,15 @@ OptionsIO::printHelp(std::ostream &os, const OptionsCont &options, size_t maxWid
         // write the description
         size_t beg = 0;
         std::string desc = options.getDescription(name);
+        const Option_Enum *enumOption = dynamic_cast<const Option_Enum*>(&options.getOptionAt(options.getOptionID(name)));
+        if(enumOption!=0) {
+            desc += desc.length()!=0 ? " " : "";
+            desc += "(one of:";
+            for(std::vector<std::string>::const_iterator j=enumOption->getChoices().begin(); j!=enumOption->getChoices().end(); ++j) {
+                desc += " " + *j;
+            }
+            desc += ")";
+        }
         size_t offset = divider+optMaxWidth-owidth;
         size_t startCol = divider+optMaxWidth+optionIndent;
         while(beg<desc.length()) {
@@ -23,6 +23,7 @@
  * included modules
  * ======================================================================= */
 #include <string>
+#include <future>
 
 /* -------------------------------------------------------------------
  * (optional) memory checking
@@ -54,6 +55,9 @@ class OptionsTypedFileIO;
 class OptionsIO {
 public:
     /** @brief Parses options from the command line and optionally loads options from a configuration file
+     *
+     * Change notifications (see OptionsCont::subscribe) are delivered as one batch.
+     *  Afterwards, the rules on given options are checked (see OptionsCont::checkRules).
 	 * @param[in] into The options container to fill
 	 * @param[in] argc The number of arguments given on the command line
 	 * @param[in] argv The arguments given on the command line
@@ -70,6 +74,72 @@ public:
         bool continueOnError=false, bool acceptUnknown=false);
 
 
+    /** @brief Parses options from the command line and the environment and optionally loads options from a configuration file
+     *
+     * The command line is parsed first, then the environment variables starting
+     *  with the given prefix are read, then the configuration is loaded. Options
+     *  that have been set are not overwritten, so the command line has the highest
+     *  and the configuration file the lowest precedence. Change notifications
+     *  are delivered as one batch. Afterwards, the rules on given options are
+     *  checked (see OptionsCont::checkRules).
+     * @param[in] into The options container to fill
+     * @param[in] argc The number of arguments given on the command line
+     * @param[in] argv The arguments given on the command line
+     * @param[in] envPrefix The prefix of environment variables to read (see OptionsEnvironmentParser)
+     * @param[in] fileIO The file reading handler to use
+     * @param[in] configOptionName The name of the option to get the path to the configuration to load from
+     * @param[in] continueOnError Continues even if an error occures while parsing
+  	 * @param[in] acceptUnknown Unknown options do not throw an exception
+     * @return Whether parsing and loading was successful
+     */
+    static bool parseAndLoad(OptionsCont &into, int argc, char **argv,
+        const std::string &envPrefix, OptionsTypedFileIO &fileIO, const std::string &configOptionName,
+        bool continueOnError=false, bool acceptUnknown=false);
+
+
+    /** @brief Parses and loads the options on a worker thread
+     *
+     * Performs parseAndLoad(into, argc, argv, fileIO, configOptionName, ...)
+     *  on a worker thread. The options container is marked as being loaded
+     *  (see OptionsCont::beginLoading) before this method returns, so that
+     *  the typed getters and handles block if they are called before the
+     *  loading has finished; the application may construct everything that
+     *  does not depend on options meanwhile.
+     *
+     * The arguments, the file reading handler and the container must remain
+     *  valid until the loading is finished. As for std::async, releasing the
+     *  last copy of the returned future waits for the worker.
+     * @param[in] into The options container to fill
+     * @param[in] argc The number of arguments given on the command line
+     * @param[in] argv The arguments given on the command line
+     * @param[in] fileIO The file reading handler to use
+     * @param[in] configOptionName The name of the option to get the path to the configuration to load from
+     * @param[in] continueOnError Continues even if an error occures while parsing
+  	 * @param[in] acceptUnknown Unknown options do not throw an exception
+     * @return The future result of parseAndLoad; exceptions are passed on
+     */
+    static std::shared_future<bool> parseAndLoadAsync(OptionsCont &into, int argc, char **argv,
+        OptionsTypedFileIO &fileIO, const std::string &configOptionName,
+        bool continueOnError=false, bool acceptUnknown=false);
+
+
+    /** @brief Parses the command line and the environment and loads the options on a worker thread
+     * @see parseAndLoadAsync(OptionsCont&, int, char**, OptionsTypedFileIO&, const std::string&, bool, bool)
+     * @param[in] into The options container to fill
+     * @param[in] argc The number of arguments given on the command line
+     * @param[in] argv The arguments given on the command line
+     * @param[in] envPrefix The prefix of environment variables to read (see OptionsEnvironmentParser)
+     * @param[in] fileIO The file reading handler to use
+     * @param[in] configOptionName The name of the option to get the path to the configuration to load from
+     * @param[in] continueOnError Continues even if an error occures while parsing
+  	 * @param[in] acceptUnknown Unknown options do not throw an exception
+     * @return The future result of parseAndLoad; exceptions are passed on
+     */
+    static std::shared_future<bool> parseAndLoadAsync(OptionsCont &into, int argc, char **argv,
+        const std::string &envPrefix, OptionsTypedFileIO &fileIO, const std::string &configOptionName,
+        bool continueOnError=false, bool acceptUnknown=false);
+
+
     /** @brief Output operator
      * @param[in] os The output container to write
      * @param[in] options The options to print
@@ -0,0 +1,141 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsMappedFile.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <fstream>
+#if !defined _MSC_VER && !defined __BORLANDC__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "OptionsMappedFile.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+OptionsMappedFile::OptionsMappedFile()
+    : myData(0), mySize(0), myAmMapped(false) {
+}
+
+
+OptionsMappedFile::~OptionsMappedFile() {
+    close();
+}
+
+
+bool
+OptionsMappedFile::open(const std::string &fileName) {
+    close();
+#if !defined _MSC_VER && !defined __BORLANDC__
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if(fd<0) {
+        return false;
+    }
+    struct stat st;
+    if(fstat(fd, &st)!=0) {
+        ::close(fd);
+        return false;
+    }
+    mySize = (size_t) st.st_size;
+    if(mySize!=0) {
+        void *data = mmap(0, mySize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(data==MAP_FAILED) {
+            ::close(fd);
+            mySize = 0;
+            return false;
+        }
+#ifdef MADV_SEQUENTIAL
+        madvise(data, mySize, MADV_SEQUENTIAL);
+#endif
+        myData = (const char*) data;
+        myAmMapped = true;
+    }
+    ::close(fd);
+    return true;
+#else
+    std::ifstream fdi(fileName.c_str(), std::ios::in|std::ios::binary);
+    if(!fdi.good()) {
+        return false;
+    }
+    fdi.seekg(0, std::ios::end);
+    mySize = (size_t) fdi.tellg();
+    fdi.seekg(0, std::ios::beg);
+    if(mySize!=0) {
+        char *data = new char[mySize];
+        fdi.read(data, mySize);
+        myData = data;
+    }
+    return true;
+#endif
+}
+
+
+void
+OptionsMappedFile::close() {
+    if(myData!=0) {
+#if !defined _MSC_VER && !defined __BORLANDC__
+        if(myAmMapped) {
+            munmap((void*) myData, mySize);
+        } else {
+            delete[] myData;
+        }
+#else
+        delete[] myData;
+#endif
+    }
+    myData = 0;
+    mySize = 0;
+    myAmMapped = false;
+}
+
+
+const char *
+OptionsMappedFile::getData() const {
+    return myData;
+}
+
+
+size_t
+OptionsMappedFile::getSize() const {
+    return mySize;
+}
+
+
+
+// *************************************************************************
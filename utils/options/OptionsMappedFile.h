@@ -0,0 +1,100 @@
+#ifndef OptionsMappedFile_h
+#define OptionsMappedFile_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsMappedFile.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsMappedFile
+ * @brief A read-only view on a file's contents
+ *
+ * On POSIX systems, the file is memory-mapped. On other systems, it is
+ *  read into memory at once.
+ */
+class OptionsMappedFile {
+public:
+    /// @brief Constructor
+    OptionsMappedFile();
+
+
+    /// @brief Destructor, releases the file's contents
+    ~OptionsMappedFile();
+
+
+    /** @brief Opens (maps) the named file
+     * @param[in] fileName The name of the file to open
+     * @return Whether the file could be opened
+     */
+    bool open(const std::string &fileName);
+
+
+    /// @brief Releases the file's contents
+    void close();
+
+
+    /** @brief Returns the begin of the file's contents
+     * @return The file's contents (not 0-terminated)
+     */
+    const char *getData() const;
+
+
+    /** @brief Returns the size of the file's contents
+     * @return The size of the file in bytes
+     */
+    size_t getSize() const;
+
+
+private:
+    /// @brief The file's contents
+    const char *myData;
+
+    /// @brief The size of the file's contents
+    size_t mySize;
+
+    /// @brief Whether the contents are mapped (or allocated)
+    bool myAmMapped;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsMappedFile(const OptionsMappedFile &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsMappedFile &operator=(const OptionsMappedFile &s);
+
+
+};
+
+
+// *************************************************************************
+#endif
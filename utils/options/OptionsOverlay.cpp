@@ -0,0 +1,250 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsOverlay.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include "Option.h"
+#include "OptionsCont.h"
+#include "OptionsOverlay.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+OptionsOverlay::OptionsOverlay(const OptionsCont &base)
+    : myBase(base), myParent(0) {
+}
+
+
+OptionsOverlay::OptionsOverlay(const OptionsOverlay *parent)
+    : myBase(parent->myBase), myParent(parent) {
+}
+
+
+OptionsOverlay::~OptionsOverlay() {
+    for(std::vector<std::pair<size_t, Option*> >::iterator i=myOverrides.begin(); i!=myOverrides.end(); ++i) {
+        delete (*i).second;
+    }
+}
+
+
+void
+OptionsOverlay::set(const std::string &name, const std::string &value) {
+    size_t id = myBase.getOptionID(name);
+    // the override has the option's type; its set() parses the value
+    Option *option = myBase.getOptionAt(id).clone();
+    option->remarkSetable();
+    try {
+        option->set(value);
+    } catch(std::runtime_error &e) {
+        delete option;
+        throw std::runtime_error("Could not set option '" + name + "'; reason: " + e.what());
+    }
+    std::vector<std::pair<size_t, Option*> >::iterator i = myOverrides.begin() + (lowerBound(id) - myOverrides.begin());
+    if(i!=myOverrides.end() && (*i).first==id) {
+        delete (*i).second;
+        (*i).second = option;
+    } else {
+        myOverrides.insert(i, std::make_pair(id, option));
+    }
+}
+
+
+void
+OptionsOverlay::unset(const std::string &name) {
+    size_t id = myBase.getOptionID(name);
+    std::vector<std::pair<size_t, Option*> >::iterator i = myOverrides.begin() + (lowerBound(id) - myOverrides.begin());
+    if(i!=myOverrides.end() && (*i).first==id) {
+        delete (*i).second;
+        myOverrides.erase(i);
+    }
+}
+
+
+bool
+OptionsOverlay::overrides(const std::string &name) const {
+    size_t id = myBase.getOptionID(name);
+    std::vector<std::pair<size_t, Option*> >::const_iterator i = lowerBound(id);
+    return i!=myOverrides.end() && (*i).first==id;
+}
+
+
+size_t
+OptionsOverlay::size() const {
+    return myOverrides.size();
+}
+
+
+const OptionsCont &
+OptionsOverlay::getBase() const {
+    return myBase;
+}
+
+
+const OptionsOverlay *
+OptionsOverlay::getParent() const {
+    return myParent;
+}
+
+
+const Option *
+OptionsOverlay::find(size_t id) const {
+    for(const OptionsOverlay *overlay=this; overlay!=0; overlay=overlay->myParent) {
+        if(overlay->myOverrides.empty()) {
+            continue;
+        }
+        std::vector<std::pair<size_t, Option*> >::const_iterator i = overlay->lowerBound(id);
+        if(i!=overlay->myOverrides.end() && (*i).first==id) {
+            return (*i).second;
+        }
+    }
+    return 0;
+}
+
+
+
+/* -------------------------------------------------------------------------
+ * Retrieving Option Values
+ * ----------------------------------------------------------------------- */
+int
+OptionsOverlay::getInteger(const std::string &name) const {
+    const Option *option = getOption(name);
+    const Option_Integer *o = dynamic_cast<const Option_Integer*>(option);
+    if(o==0) {
+        const Option_TunableInteger *tunable = dynamic_cast<const Option_TunableInteger*>(option);
+        if(tunable!=0) {
+            return tunable->getValue();
+        }
+        throw std::runtime_error("Option '" + name + "' is not an integer option!");
+    }
+    if(!o->isSet()) {
+        throw std::runtime_error("The option '" + name + "' is not set!");
+    }
+    return o->getValue();
+}
+
+
+double
+OptionsOverlay::getDouble(const std::string &name) const {
+    const Option *option = getOption(name);
+    const Option_Double *o = dynamic_cast<const Option_Double*>(option);
+    if(o==0) {
+        const Option_TunableDouble *tunable = dynamic_cast<const Option_TunableDouble*>(option);
+        if(tunable!=0) {
+            return tunable->getValue();
+        }
+        throw std::runtime_error("Option '" + name + "' is not a double option!");
+    }
+    if(!o->isSet()) {
+        throw std::runtime_error("The option '" + name + "' is not set!");
+    }
+    return o->getValue();
+}
+
+
+bool
+OptionsOverlay::getBool(const std::string &name) const {
+    const Option_Bool *o = dynamic_cast<const Option_Bool*>(getOption(name));
+    if(o==0) {
+        throw std::runtime_error("Option '" + name + "' is not a bool option!");
+    }
+    if(!o->isSet()) {
+        throw std::runtime_error("The option '" + name + "' is not set!");
+    }
+    return o->getValue();
+}
+
+
+const std::string &
+OptionsOverlay::getString(const std::string &name) const {
+    const Option_String *o = dynamic_cast<const Option_String*>(getOption(name));
+    if(o==0) {
+        throw std::runtime_error("Option '" + name + "' is not a string option!");
+    }
+    if(!o->isSet()) {
+        throw std::runtime_error("The option '" + name + "' is not set!");
+    }
+    return o->getValue();
+}
+
+
+std::string
+OptionsOverlay::getValueAsString(const std::string &name) const {
+    return getOption(name)->getValueAsString();
+}
+
+
+bool
+OptionsOverlay::isSet(const std::string &name) const {
+    return getOption(name)->isSet();
+}
+
+
+
+/* -------------------------------------------------------------------------
+ * Private helper methods
+ * ----------------------------------------------------------------------- */
+const Option *
+OptionsOverlay::getOption(const std::string &name) const {
+    myBase.waitLoaded();
+    size_t id = myBase.getOptionID(name);
+    const Option *option = find(id);
+    return option!=0 ? option : &myBase.getOptionAt(id);
+}
+
+
+std::vector<std::pair<size_t, Option*> >::const_iterator
+OptionsOverlay::lowerBound(size_t id) const {
+    std::vector<std::pair<size_t, Option*> >::const_iterator i = myOverrides.begin();
+    size_t count = myOverrides.size();
+    while(count>0) {
+        size_t step = count / 2;
+        if((*(i+step)).first<id) {
+            i += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return i;
+}
+
+
+// *************************************************************************
@@ -0,0 +1,212 @@
+#ifndef OptionsOverlay_h
+#define OptionsOverlay_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsOverlay.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <utility>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class Option;
+class OptionsCont;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsOverlay
+ * @brief A view on an options container that overrides some of its values
+ *
+ * The overlay stores only the overridden options, sorted by their IDs
+ *  (see OptionsCont::getOptionID) in a flat vector. Reading an option
+ *  looks into the overlay, then into the overlays it is stacked on, and
+ *  finally into the base container. The base container is not changed.
+ *
+ * Building an empty overlay allocates nothing. The base container (and
+ *  the overlays stacked on) must outlive the overlay.
+ */
+class OptionsOverlay {
+public:
+    /** @brief Constructor, overlays the options container
+     * @param[in] base The options container to override values of
+     */
+    OptionsOverlay(const OptionsCont &base);
+
+
+    /** @brief Constructor, stacks this overlay onto another one
+     * @param[in] parent The overlay to override values of
+     */
+    OptionsOverlay(const OptionsOverlay *parent);
+
+
+    /// @brief Destructor
+    ~OptionsOverlay();
+
+
+    /** @brief Overrides the named option's value
+     *
+     * A value overridden before by this overlay is replaced.
+     * @param[in] name The name of the option to override
+     * @param[in] value The value to set
+     * @throw runtime_error If the option is not known or the value is invalid
+     */
+    void set(const std::string &name, const std::string &value);
+
+
+    /** @brief Removes this overlay's override of the named option
+     * @param[in] name The name of the option
+     */
+    void unset(const std::string &name);
+
+
+    /** @brief Returns whether this overlay overrides the named option
+     * @param[in] name The name of the option
+     * @return Whether this overlay overrides the option
+     */
+    bool overrides(const std::string &name) const;
+
+
+    /** @brief Returns the number of options overridden by this overlay
+     * @return The number of overridden options
+     */
+    size_t size() const;
+
+
+    /** @brief Returns the overlaid options container
+     * @return The base container
+     */
+    const OptionsCont &getBase() const;
+
+
+    /** @brief Returns the overlay this one is stacked onto
+     * @return The parent overlay, 0 if this overlay overlays the container directly
+     */
+    const OptionsOverlay *getParent() const;
+
+
+    /** @brief Returns the option that defines the value of the option with the given ID
+     * @param[in] id The ID of the option
+     * @return The overriding option of this overlay or the ones stacked on, 0 if none overrides it
+     */
+    const Option *find(size_t id) const;
+
+
+    /// @brief Retrieving Option Values
+    /// @{
+
+    /** @brief Returns the integer value of the named option
+     * @param[in] name The name of the option to retrieve the value from
+	 * @return The named option's value
+	 */
+    int getInteger(const std::string &name) const;
+
+
+    /** @brief Returns the float value of the named option
+	 * @param[in] name The name of the option to retrieve the value from
+	 * @return The named option's value
+	 */
+    double getDouble(const std::string &name) const;
+
+
+    /** @brief Returns the boolean value of the named option
+	 * @param[in] name The name of the option to retrieve the value from
+	 * @return The named option's value
+	 */
+    bool getBool(const std::string &name) const;
+
+
+    /** @brief Returns the string value of the named option
+     * @param[in] name The name of the option to retrieve the value from
+     * @return The named option's value
+     */
+    const std::string &getString(const std::string &name) const;
+
+
+    /** @brief Returns the value of the named option as a string
+     * @param[in] name The name of the option to retrieve the value from
+     * @return The string representation of the option's value
+     */
+    std::string getValueAsString(const std::string &name) const;
+
+
+    /** @brief Returns the information whether the option is set
+     * @param[in] name The name of the option to check
+     * @return Whether the option has a value set
+     */
+    bool isSet(const std::string &name) const;
+    /// @}
+
+
+private:
+    /** @brief Returns the option that defines the value of the named option
+     * @param[in] name The name of the option
+     * @return The overriding option or the base container's one
+     * @throw runtime_error If the option is not known
+     */
+    const Option *getOption(const std::string &name) const;
+
+
+    /** @brief Returns the position of the option with the given ID in myOverrides
+     * @param[in] id The ID of the option
+     * @return The position the option is (or would be) stored at
+     */
+    std::vector<std::pair<size_t, Option*> >::const_iterator lowerBound(size_t id) const;
+
+
+private:
+    /// @brief The overlaid options container
+    const OptionsCont &myBase;
+
+    /// @brief The overlay this one is stacked onto, 0 if none
+    const OptionsOverlay *myParent;
+
+    /// @brief The overriding options by ID, sorted by ID
+    std::vector<std::pair<size_t, Option*> > myOverrides;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsOverlay(const OptionsOverlay &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsOverlay &operator=(const OptionsOverlay &s);
+
+
+};
+
+
+// *************************************************************************
+#endif
@@ -0,0 +1,86 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsOverrideScope.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include "OptionsCont.h"
+#include "OptionsOverlay.h"
+#include "OptionsOverrideScope.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * static member definitions
+ * ======================================================================= */
+OPTIONS_THREAD_LOCAL OptionsOverrideScope *OptionsOverrideScope::myInnermost = 0;
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+OptionsOverrideScope::OptionsOverrideScope(const OptionsCont &options)
+    : myOverlay(options), myOuter(myInnermost) {
+    myInnermost = this;
+}
+
+
+OptionsOverrideScope::~OptionsOverrideScope() {
+    myInnermost = myOuter;
+}
+
+
+void
+OptionsOverrideScope::set(const std::string &name, const std::string &value) {
+    myOverlay.set(name, value);
+}
+
+
+const Option *
+OptionsOverrideScope::find(const OptionsCont &options, size_t id) {
+    for(const OptionsOverrideScope *scope=myInnermost; scope!=0; scope=scope->myOuter) {
+        if(&scope->myOverlay.getBase()!=&options) {
+            continue;
+        }
+        const Option *option = scope->myOverlay.find(id);
+        if(option!=0) {
+            return option;
+        }
+    }
+    return 0;
+}
+
+
+// *************************************************************************
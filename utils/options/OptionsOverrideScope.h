@@ -0,0 +1,132 @@
+#ifndef OptionsOverrideScope_h
+#define OptionsOverrideScope_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsOverrideScope.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include "OptionsOverlay.h"
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * definitions
+ * ======================================================================= */
+/// @brief Storage class specifier for thread-local variables (msvc2013 does not know thread_local)
+#if defined _MSC_VER && _MSC_VER<1900
+#define OPTIONS_THREAD_LOCAL __declspec(thread)
+#else
+#define OPTIONS_THREAD_LOCAL thread_local
+#endif
+
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class Option;
+class OptionsCont;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsOverrideScope
+ * @brief Overrides option values for the current thread while existing
+ *
+ * Scopes form a stack per thread; the innermost scope's values win. Typed
+ *  handles (see OptionsHandle) read the overridden values on the thread
+ *  the scope was built on, other threads are not affected. Reading through
+ *  a handle on a thread without scopes costs one check of a thread-local
+ *  pointer.
+ *
+ * Scopes must be destroyed in the reverse order of their construction
+ *  and on the thread they were built on; use them as local variables.
+ */
+class OptionsOverrideScope {
+public:
+    /** @brief Constructor, pushes the scope onto the current thread's stack
+     * @param[in] options The options container to override values of
+     */
+    OptionsOverrideScope(const OptionsCont &options);
+
+
+    /// @brief Destructor, pops the scope from the current thread's stack
+    ~OptionsOverrideScope();
+
+
+    /** @brief Overrides the named option's value within this scope
+     * @param[in] name The name of the option to override
+     * @param[in] value The value to set
+     * @throw runtime_error If the option is not known or the value is invalid
+     */
+    void set(const std::string &name, const std::string &value);
+
+
+    /** @brief Returns whether the current thread has override scopes
+     * @return Whether a scope exists on the current thread
+     */
+    static bool isActive() {
+        return myInnermost!=0;
+    }
+
+
+    /** @brief Returns the option overriding the given one on the current thread
+     * @param[in] options The options container the option belongs to
+     * @param[in] id The ID of the option
+     * @return The overriding option of the innermost scope that overrides it, 0 if none does
+     */
+    static const Option *find(const OptionsCont &options, size_t id);
+
+
+private:
+    /// @brief The overridden values
+    OptionsOverlay myOverlay;
+
+    /// @brief The scope that was the innermost one before this was built
+    OptionsOverrideScope *myOuter;
+
+    /// @brief The current thread's innermost scope
+    static OPTIONS_THREAD_LOCAL OptionsOverrideScope *myInnermost;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsOverrideScope(const OptionsOverrideScope &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsOverrideScope &operator=(const OptionsOverrideScope &s);
+
+
+};
+
+
+// *************************************************************************
+#endif
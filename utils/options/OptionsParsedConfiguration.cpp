@@ -0,0 +1,310 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsParsedConfiguration.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include "OptionsCont.h"
+#include "OptionsHash.h"
+#include "OptionsParsedConfiguration.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+OptionsParsedConfiguration::OptionsParsedConfiguration()
+    : myCurrentSection(-1), myUnknownAreErrors(false), mySectionScanner(0) {
+}
+
+
+OptionsParsedConfiguration::~OptionsParsedConfiguration() {
+}
+
+
+void
+OptionsParsedConfiguration::beginSection(const std::string &section) {
+    mySections.push_back(section);
+    myCurrentSection = (int) mySections.size() - 1;
+}
+
+
+void
+OptionsParsedConfiguration::add(const std::string &name, const std::string &value) {
+    Entry e;
+    e.name = store(name);
+    e.nameLength = name.length();
+    e.value = store(value);
+    e.valueLength = value.length();
+    e.section = myCurrentSection;
+    e.isError = false;
+    e.isRaw = false;
+    e.line = 0;
+    myEntries.push_back(e);
+    if(myEntryListener && std::find(myListenedNames.begin(), myListenedNames.end(), name)!=myListenedNames.end()) {
+        std::function<void(const std::string &)> listener = myEntryListener;
+        removeEntryListener();
+        listener(value);
+    }
+}
+
+
+void
+OptionsParsedConfiguration::addSectionError(const std::string &message) {
+    Entry e;
+    e.name = store(message);
+    e.nameLength = message.length();
+    e.value = e.name + e.nameLength;
+    e.valueLength = 0;
+    e.section = myCurrentSection;
+    e.isError = true;
+    e.isRaw = false;
+    e.line = 0;
+    myEntries.push_back(e);
+}
+
+
+void
+OptionsParsedConfiguration::addRawSection(const std::string &section, const char *data, size_t size, size_t line) {
+    beginSection(section);
+    Entry e;
+    e.name = myData.length();
+    e.nameLength = 0;
+    e.value = myData.length();
+    e.valueLength = size;
+    myData.append(data, size);
+    e.section = myCurrentSection;
+    e.isError = false;
+    e.isRaw = true;
+    e.line = line;
+    myEntries.push_back(e);
+}
+
+
+void
+OptionsParsedConfiguration::setSectionScanner(SectionScanner scanner) {
+    mySectionScanner = scanner;
+}
+
+
+void
+OptionsParsedConfiguration::setUnknownAreErrors(bool value) {
+    myUnknownAreErrors = value;
+}
+
+
+size_t
+OptionsParsedConfiguration::getEntryNumber() const {
+    return myEntries.size();
+}
+
+
+std::string
+OptionsParsedConfiguration::getName(size_t index) const {
+    const Entry &e = myEntries[index];
+    return myData.substr(e.name, e.nameLength);
+}
+
+
+std::string
+OptionsParsedConfiguration::getValue(size_t index) const {
+    const Entry &e = myEntries[index];
+    return myData.substr(e.value, e.valueLength);
+}
+
+
+bool
+OptionsParsedConfiguration::getValue(const std::vector<std::string> &names, std::string &value) const {
+    for(std::vector<Entry>::const_iterator i=myEntries.begin(); i!=myEntries.end(); ++i) {
+        if((*i).isError || (*i).isRaw) {
+            continue;
+        }
+        for(std::vector<std::string>::const_iterator j=names.begin(); j!=names.end(); ++j) {
+            if((*i).nameLength==(*j).length() && myData.compare((*i).name, (*i).nameLength, *j)==0) {
+                value.assign(myData, (*i).value, (*i).valueLength);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+
+void
+OptionsParsedConfiguration::setEntryListener(const std::vector<std::string> &names, std::function<void(const std::string &)> listener) {
+    myListenedNames = names;
+    myEntryListener = listener;
+}
+
+
+void
+OptionsParsedConfiguration::removeEntryListener() {
+    myListenedNames.clear();
+    myEntryListener = nullptr;
+}
+
+
+bool
+OptionsParsedConfiguration::apply(OptionsCont &into, const std::string &fileName,
+                                  std::vector<std::pair<std::string, unsigned long long> > *applied,
+                                  std::map<size_t, std::shared_ptr<const Option> > *previous) const {
+    // whether the sections are known is determined once per section
+    std::vector<bool> knownSections;
+    knownSections.reserve(mySections.size());
+    for(std::vector<std::string>::const_iterator i=mySections.begin(); i!=mySections.end(); ++i) {
+        knownSections.push_back(into.hasSection(*i));
+    }
+    std::string name, value;
+    for(std::vector<Entry>::const_iterator i=myEntries.begin(); i!=myEntries.end(); ++i) {
+        const Entry &e = *i;
+        if(e.section>=0 && !knownSections[e.section]) {
+            continue;
+        }
+        if(e.isRaw) {
+            if(!getScannedSection(e, fileName)->apply(into, fileName, applied, previous)) {
+                return false;
+            }
+            continue;
+        }
+        name.assign(myData, e.name, e.nameLength);
+        if(e.isError) {
+            std::cerr << std::endl << name << std::endl;
+            return false;
+        }
+        bool known = e.section>=0 ? into.containsInSection(mySections[e.section], name) : into.contains(name);
+        if(!known) {
+            if(myUnknownAreErrors) {
+                throw std::runtime_error("Could not set option '" + name + "' from '" + fileName + "'; reason: Option '" + name + "' is not known.");
+            }
+            continue;
+        }
+        if(!into.canBeSet(name)) {
+            continue;
+        }
+        value.assign(myData, e.value, e.valueLength);
+        if(previous!=0) {
+            // only the options actually set are copied, once per load
+            const size_t id = into.getOptionID(name);
+            if(previous->find(id)==previous->end()) {
+                (*previous)[id] = std::shared_ptr<const Option>(into.getOptionAt(id).clone());
+            }
+        }
+        try {
+            into.set(name, value);
+        } catch(std::runtime_error &ex) {
+            throw std::runtime_error("Could not set option '" + name + "' from '" + fileName + "'; reason: " + ex.what());
+        }
+        if(applied!=0) {
+            applied->push_back(std::make_pair(name, OptionsHash::fnv1a(value)));
+        }
+    }
+    return true;
+}
+
+
+bool
+OptionsParsedConfiguration::resolve(const OptionsCont &options, const std::string &fileName, std::map<size_t, std::string> &values) const {
+    std::vector<bool> knownSections;
+    knownSections.reserve(mySections.size());
+    for(std::vector<std::string>::const_iterator i=mySections.begin(); i!=mySections.end(); ++i) {
+        knownSections.push_back(options.hasSection(*i));
+    }
+    std::string name;
+    for(std::vector<Entry>::const_iterator i=myEntries.begin(); i!=myEntries.end(); ++i) {
+        const Entry &e = *i;
+        if(e.section>=0 && !knownSections[e.section]) {
+            continue;
+        }
+        if(e.isRaw) {
+            if(!getScannedSection(e, fileName)->resolve(options, fileName, values)) {
+                return false;
+            }
+            continue;
+        }
+        name.assign(myData, e.name, e.nameLength);
+        if(e.isError) {
+            std::cerr << std::endl << name << std::endl;
+            return false;
+        }
+        bool known = e.section>=0 ? options.containsInSection(mySections[e.section], name) : options.contains(name);
+        if(!known) {
+            if(myUnknownAreErrors) {
+                throw std::runtime_error("Could not set option '" + name + "' from '" + fileName + "'; reason: Option '" + name + "' is not known.");
+            }
+            continue;
+        }
+        size_t id = options.getOptionID(name);
+        if(values.find(id)==values.end()) {
+            values[id] = myData.substr(e.value, e.valueLength);
+        }
+    }
+    return true;
+}
+
+
+std::shared_ptr<const OptionsParsedConfiguration>
+OptionsParsedConfiguration::getScannedSection(const Entry &e, const std::string &fileName) const {
+    std::lock_guard<std::mutex> lock(myScanLock);
+    if(myScannedSections.size()<mySections.size()) {
+        myScannedSections.resize(mySections.size());
+    }
+    std::shared_ptr<const OptionsParsedConfiguration> &scanned = myScannedSections[e.section];
+    if(!scanned) {
+        std::shared_ptr<OptionsParsedConfiguration> section = std::make_shared<OptionsParsedConfiguration>();
+        section->setUnknownAreErrors(myUnknownAreErrors);
+        if(mySectionScanner!=0) {
+            mySectionScanner(mySections[e.section], myData.data()+e.value, e.valueLength, e.line, fileName, *section);
+        }
+        scanned = section;
+    }
+    return scanned;
+}
+
+
+size_t
+OptionsParsedConfiguration::store(const std::string &s) {
+    size_t offset = myData.length();
+    myData.append(s);
+    return offset;
+}
+
+
+// *************************************************************************
@@ -0,0 +1,291 @@
+#ifndef OptionsParsedConfiguration_h
+#define OptionsParsedConfiguration_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsParsedConfiguration.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class OptionsCont;
+class Option;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsParsedConfiguration
+ * @brief The name/value pairs read from a configuration file
+ *
+ * The file readers store what they have read in an instance of this class
+ *  instead of setting the options directly. The parsed configuration does
+ *  not depend on an options container and can therefore be cached and
+ *  applied to any number of containers.
+ *
+ * All names and values are stored in a single character blob, the entries
+ *  keep the offsets into it only.
+ *
+ * Entries may belong to a section (see OptionsCont::beginSection). Such
+ *  entries are only applied if the container knows the section and the option
+ *  belongs to it. Errors found within a section are stored as well and are
+ *  only reported if the section is known when the configuration is applied.
+ *
+ * Readers may keep the bodies of sections unscanned (see addRawSection).
+ *  A raw section is scanned the first time it is applied to or resolved
+ *  against a container that knows it; sections no container knows are
+ *  never scanned.
+ */
+class OptionsParsedConfiguration {
+public:
+    /** @brief A function scanning the body of a raw section into the given configuration
+     * @param[in] section The name of the section
+     * @param[in] data The begin of the section's body
+     * @param[in] size The size of the section's body
+     * @param[in] line The line the body starts at (for reporting)
+     * @param[in] fileName The name of the file the section was read from (for reporting)
+     * @param[out] into The configuration to add the section's entries and errors to
+     */
+    typedef void (*SectionScanner)(const std::string &section, const char *data, size_t size, size_t line,
+                                   const std::string &fileName, OptionsParsedConfiguration &into);
+
+
+    /// @brief Constructor
+    OptionsParsedConfiguration();
+
+
+    /// @brief Destructor
+    ~OptionsParsedConfiguration();
+
+
+    /** @brief Begins a section; all following entries belong to it
+     * @param[in] section The name of the section
+     */
+    void beginSection(const std::string &section);
+
+
+    /** @brief Adds a name/value pair
+     * @param[in] name The name of the option
+     * @param[in] value The value of the option
+     */
+    void add(const std::string &name, const std::string &value);
+
+
+    /** @brief Adds an error found within the current section
+     * @param[in] message The complete error message (reported when the configuration is applied)
+     */
+    void addSectionError(const std::string &message);
+
+
+    /** @brief Adds a section whose body is kept unscanned
+     *
+     * The body is copied and scanned using the section scanner (see
+     *  setSectionScanner) only if a container knows the section.
+     * @param[in] section The name of the section
+     * @param[in] data The begin of the section's body
+     * @param[in] size The size of the section's body
+     * @param[in] line The line the body starts at
+     */
+    void addRawSection(const std::string &section, const char *data, size_t size, size_t line);
+
+
+    /** @brief Sets the function that scans raw sections
+     * @param[in] scanner The function to scan raw sections with
+     */
+    void setSectionScanner(SectionScanner scanner);
+
+
+    /** @brief Sets whether unknown options shall be reported as errors
+     * @param[in] value Whether unknown options are errors (they are skipped per default)
+     */
+    void setUnknownAreErrors(bool value);
+
+
+    /** @brief Returns the number of stored entries (including errors)
+     * @return The number of entries
+     */
+    size_t getEntryNumber() const;
+
+
+    /** @brief Returns the name of the option stored at the given index
+     * @param[in] index The index of the entry
+     * @return The name of the option (the message for errors)
+     */
+    std::string getName(size_t index) const;
+
+
+    /** @brief Returns the value stored at the given index
+     * @param[in] index The index of the entry
+     * @return The value of the option
+     */
+    std::string getValue(size_t index) const;
+
+
+    /** @brief Returns the first value given for an option with one of the given names
+     *
+     * As options can be set only once, this is the value that is applied.
+     *  Raw sections are not searched.
+     * @param[in] names The names (synonyms) of the option
+     * @param[out] value The value, if found
+     * @return Whether a value was given for the option
+     */
+    bool getValue(const std::vector<std::string> &names, std::string &value) const;
+
+
+    /** @brief Sets a listener that is called once for the first entry with one of the given names
+     *
+     * The listener is called while the file is parsed, which allows to act on
+     *  the value (e.g. to start reading a parent configuration) before the
+     *  parsing is finished. It is removed after being called.
+     * @param[in] names The names (synonyms) of the option to listen to
+     * @param[in] listener The method to call with the entry's value
+     */
+    void setEntryListener(const std::vector<std::string> &names, std::function<void(const std::string &)> listener);
+
+
+    /// @brief Removes the entry listener
+    void removeEntryListener();
+
+
+    /** @brief Sets the stored options within the given container
+     *
+     * Options are only set if they are known (within the entry's section, if any)
+     *  and if they can be set.
+     * @param[in] into The options container to fill
+     * @param[in] fileName The name of the file the configuration was read from (for reporting)
+     * @param[out] applied If given, the names of the options that were set and the hashes of their values are appended
+     * @param[out] previous If given, a copy of each option set is stored by its ID before it is set (unless one is stored already)
+     * @return Whether no (known) error was stored
+     * @throw runtime_error If a value could not be set
+     */
+    bool apply(OptionsCont &into, const std::string &fileName,
+        std::vector<std::pair<std::string, unsigned long long> > *applied=0,
+        std::map<size_t, std::shared_ptr<const Option> > *previous=0) const;
+
+
+    /** @brief Collects the values the configuration gives for the options of the given container
+     *
+     * The same rules as for apply hold, but nothing is set: an option's value
+     *  is only stored if no value is stored for it yet.
+     * @param[in] options The options container to resolve the names against
+     * @param[in] fileName The name of the file the configuration was read from (for reporting)
+     * @param[in, out] values The values by option ID
+     * @return Whether no (known) error was stored
+     * @throw runtime_error If an unknown option is an error
+     */
+    bool resolve(const OptionsCont &options, const std::string &fileName, std::map<size_t, std::string> &values) const;
+
+
+private:
+    /**
+     * @struct Entry
+     * @brief A single name/value pair, given as offsets into the blob
+     */
+    struct Entry {
+        /// @brief The offset of the name
+        size_t name;
+        /// @brief The length of the name
+        size_t nameLength;
+        /// @brief The offset of the value
+        size_t value;
+        /// @brief The length of the value
+        size_t valueLength;
+        /// @brief The index of the section (-1 if none)
+        int section;
+        /// @brief Whether the entry is an error message
+        bool isError;
+        /// @brief Whether the entry is the unscanned body of a section (given by value)
+        bool isRaw;
+        /// @brief The line the body starts at (raw sections only)
+        size_t line;
+    };
+
+
+    /** @brief Returns the scanned entries of a raw section, scanning it on first use
+     * @param[in] e The raw section's entry
+     * @param[in] fileName The name of the file the configuration was read from (for reporting)
+     * @return The section's entries and errors
+     */
+    std::shared_ptr<const OptionsParsedConfiguration> getScannedSection(const Entry &e, const std::string &fileName) const;
+
+
+    /** @brief Appends the given string to the blob
+     * @param[in] s The string to append
+     * @return The offset of the appended string
+     */
+    size_t store(const std::string &s);
+
+
+private:
+    /// @brief The names and values
+    std::string myData;
+
+    /// @brief The entries
+    std::vector<Entry> myEntries;
+
+    /// @brief The names of the sections
+    std::vector<std::string> mySections;
+
+    /// @brief The index of the current section
+    int myCurrentSection;
+
+    /// @brief Whether unknown options are errors
+    bool myUnknownAreErrors;
+
+    /// @brief The names the entry listener listens to
+    std::vector<std::string> myListenedNames;
+
+    /// @brief The entry listener
+    std::function<void(const std::string &)> myEntryListener;
+
+    /// @brief The function that scans raw sections
+    SectionScanner mySectionScanner;
+
+    /// @brief The scanned raw sections by section index, filled on first use
+    mutable std::vector<std::shared_ptr<const OptionsParsedConfiguration> > myScannedSections;
+
+    /// @brief A lock for scanning raw sections
+    mutable std::mutex myScanLock;
+
+
+};
+
+
+// *************************************************************************
+#endif
@@ -112,7 +112,11 @@ OptionsParser::parseAbbreviation(OptionsCont &into, char **args, int pos, int ar
             usingParameter.push_back(tmp);
         } else {
             // otherwise simply set it
-            into.set(convert(options[i]));
+            try {
+                into.set(convert(options[i]));
+            } catch(std::runtime_error &e) {
+                throw std::runtime_error("Could not set option '" + convert(options[i]) + "'; reason: " + e.what());
+            }
         }
     }
     // check options that need a parameter
@@ -178,7 +182,11 @@ OptionsParser::parseFull(OptionsCont &into,
             // if a value has been given, inform the user
             throw std::runtime_error(string("Option '") + option + string("' does not need a value."));
         }
-        into.set(option);
+        try {
+            into.set(option);
+        } catch(std::runtime_error &e) {
+            throw std::runtime_error("Could not set option '" + option + "'; reason: " + e.what());
+        }
         return 1;
     }
     // otherwise (parameter needed)
@@ -0,0 +1,138 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsRule.cpp
+   @since        19.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <utility>
+#include "OptionsBitset.h"
+#include "OptionsRule.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+OptionsRule::OptionsRule(RuleType type, const std::vector<size_t> &ids, const std::vector<std::string> &names,
+                         const std::vector<size_t> &requiredIDs, const std::vector<std::string> &requiredNames)
+    : myType(type), myIDs(ids), myNames(names), myMasks(compile(ids)),
+      myRequiredIDs(requiredIDs), myRequiredNames(requiredNames), myRequiredMasks(compile(requiredIDs)) {
+}
+
+
+OptionsRule::~OptionsRule() {
+}
+
+
+bool
+OptionsRule::check(const OptionsBitset &given, std::string &error) const {
+    size_t number = count(myMasks, given);
+    switch(myType) {
+    case RULE_REQUIRES:
+        if(number<myIDs.size() || count(myRequiredMasks, given)==myRequiredIDs.size()) {
+            return true;
+        }
+        error = (myIDs.size()==1 ? "Option " : "Options ") + join(myIDs, myNames) + (myIDs.size()==1 ? " requires " : " require ")
+            + join(myRequiredIDs, myRequiredNames, &given, false) + ".";
+        return false;
+    case RULE_CONFLICTS:
+        if(number<=1) {
+            return true;
+        }
+        error = "Options " + join(myIDs, myNames, &given) + " must not be given together.";
+        return false;
+    case RULE_ONE_OF:
+        if(number==1) {
+            return true;
+        }
+        if(number==0) {
+            error = "One of the options " + join(myIDs, myNames) + " must be given.";
+        } else {
+            error = "Only one of the options " + join(myIDs, myNames) + " may be given, but " + join(myIDs, myNames, &given) + " are.";
+        }
+        return false;
+    case RULE_AT_LEAST_ONE:
+    default:
+        if(number!=0) {
+            return true;
+        }
+        error = "At least one of the options " + join(myIDs, myNames) + " must be given.";
+        return false;
+    }
+}
+
+
+std::vector<OptionsRule::WordMask>
+OptionsRule::compile(const std::vector<size_t> &ids) {
+    std::vector<WordMask> ret;
+    for(std::vector<size_t>::const_iterator i=ids.begin(); i!=ids.end(); ++i) {
+        size_t word = *i/OptionsBitset::WORD_BITS;
+        unsigned long long bit = 1ULL<<(*i%OptionsBitset::WORD_BITS);
+        std::vector<WordMask>::iterator j = ret.begin();
+        for(; j!=ret.end() && (*j).first!=word; ++j);
+        if(j==ret.end()) {
+            ret.push_back(WordMask(word, bit));
+        } else {
+            (*j).second |= bit;
+        }
+    }
+    return ret;
+}
+
+
+size_t
+OptionsRule::count(const std::vector<WordMask> &masks, const OptionsBitset &given) {
+    size_t ret = 0;
+    for(std::vector<WordMask>::const_iterator i=masks.begin(); i!=masks.end(); ++i) {
+        ret += OptionsBitset::popcount(given.getWord((*i).first) & (*i).second);
+    }
+    return ret;
+}
+
+
+std::string
+OptionsRule::join(const std::vector<size_t> &ids, const std::vector<std::string> &names, const OptionsBitset *given, bool isGiven) {
+    std::string ret;
+    for(size_t i=0; i<ids.size(); ++i) {
+        if(given!=0 && given->test(ids[i])!=isGiven) {
+            continue;
+        }
+        ret += (ret.length()!=0 ? ", '" : "'") + names[i] + "'";
+    }
+    return ret;
+}
+
+
+// *************************************************************************
@@ -0,0 +1,142 @@
+#ifndef OptionsRule_h
+#define OptionsRule_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsRule.h
+   @since        19.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <utility>
+#include "OptionsBitset.h"
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsRule
+ * @brief A rule on which options may or must be given together
+ *
+ * The options a rule refers to are given by their IDs and compiled into
+ *  masks over the words of a bitset of the given options (see
+ *  OptionsCont::checkRules), so that checking a rule is counting the bits
+ *  of a few masked words.
+ */
+class OptionsRule {
+public:
+    /// @brief The kinds of rules
+    enum RuleType {
+        /// @brief If all of the first options are given, all of the second ones must be given
+        RULE_REQUIRES,
+        /// @brief At most one of the options may be given
+        RULE_CONFLICTS,
+        /// @brief Exactly one of the options must be given
+        RULE_ONE_OF,
+        /// @brief At least one of the options must be given
+        RULE_AT_LEAST_ONE
+    };
+
+
+    /** @brief Constructor
+     * @param[in] type The kind of the rule
+     * @param[in] ids The IDs of the options the rule refers to (the conditions for RULE_REQUIRES)
+     * @param[in] names The names of these options, used for reporting
+     * @param[in] requiredIDs The IDs of the required options (RULE_REQUIRES only)
+     * @param[in] requiredNames The names of the required options (RULE_REQUIRES only)
+     */
+    OptionsRule(RuleType type, const std::vector<size_t> &ids, const std::vector<std::string> &names,
+        const std::vector<size_t> &requiredIDs=std::vector<size_t>(), const std::vector<std::string> &requiredNames=std::vector<std::string>());
+
+
+    /// @brief Destructor
+    ~OptionsRule();
+
+
+    /** @brief Checks the rule
+     * @param[in] given The set of the given options
+     * @param[out] error The description of the violation, if any
+     * @return Whether the rule is fulfilled
+     */
+    bool check(const OptionsBitset &given, std::string &error) const;
+
+
+private:
+    /// @brief A mask over one word of the bitset: the word's index and the mask
+    typedef std::pair<size_t, unsigned long long> WordMask;
+
+
+    /** @brief Builds the masks selecting the given IDs
+     * @param[in] ids The IDs of the options
+     * @return The masks, one per word the IDs are located in
+     */
+    static std::vector<WordMask> compile(const std::vector<size_t> &ids);
+
+
+    /** @brief Returns the number of given options selected by the masks
+     * @param[in] masks The masks
+     * @param[in] given The set of the given options
+     * @return The number of set bits
+     */
+    static size_t count(const std::vector<WordMask> &masks, const OptionsBitset &given);
+
+
+    /** @brief Returns the names of the (not) given options, quoted and separated by ", "
+     * @param[in] ids The IDs of the options
+     * @param[in] names The names of the options
+     * @param[in] given The set of the given options
+     * @param[in] isGiven Whether the given or the missing options shall be listed
+     * @return The names
+     */
+    static std::string join(const std::vector<size_t> &ids, const std::vector<std::string> &names, const OptionsBitset *given=0, bool isGiven=true);
+
+
+private:
+    /// @brief The kind of the rule
+    RuleType myType;
+
+    /// @brief The IDs and names of the options (the conditions for RULE_REQUIRES)
+    std::vector<size_t> myIDs;
+    std::vector<std::string> myNames;
+
+    /// @brief The masks selecting these options
+    std::vector<WordMask> myMasks;
+
+    /// @brief The IDs and names of the required options (RULE_REQUIRES only)
+    std::vector<size_t> myRequiredIDs;
+    std::vector<std::string> myRequiredNames;
+
+    /// @brief The masks selecting the required options
+    std::vector<WordMask> myRequiredMasks;
+
+
+};
+
+
+// *************************************************************************
+#endif
@@ -0,0 +1,255 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsSchema.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <stdexcept>
+#include <cstdlib>
+#include "Option.h"
+#include "OptionsCont.h"
+#include "OptionsConstraint.h"
+#include "OptionTyped.h"
+#include "OptionsSchema.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+OptionsSchema::OptionsSchema() { }
+
+
+OptionsSchema::~OptionsSchema() { }
+
+
+bool
+OptionsSchema::read(const std::string &fileName) {
+    std::ifstream strm(fileName.c_str());
+    if(!strm.good()) {
+        std::cerr << std::endl << "Error: Could not open the schema '" << fileName << "'." << std::endl;
+        return false;
+    }
+    std::string line;
+    while(std::getline(strm, line)) {
+        addLine(line);
+    }
+    return true;
+}
+
+
+void
+OptionsSchema::add(const char * const *lines) {
+    for(; *lines!=0; ++lines) {
+        addLine(*lines);
+    }
+}
+
+
+void
+OptionsSchema::addLine(const std::string &line) {
+    if(line.find(';')==std::string::npos) {
+        // a comment or an empty line
+        return;
+    }
+    Entry entry;
+    entry.abbr = 0;
+    std::istringstream strm(line);
+    std::string field;
+    std::getline(strm, entry.type, ';');
+    const bool isOption = isOptionType(entry.type);
+    while(std::getline(strm, field, ';')) {
+        if(!isOption) {
+            entry.names.push_back(field);
+        } else if(field.length()==0) {
+            continue;
+        } else if(field.length()==1) {
+            entry.abbr = field[0];
+        } else if(field[0]=='!') {
+            entry.description = field.substr(1);
+        } else if(field[0]=='+') {
+            entry.defaultValue = field.substr(1);
+        } else if(field[0]=='=') {
+            entry.choices.push_back(field.substr(1));
+        } else {
+            entry.names.push_back(field);
+        }
+    }
+    if(!isOption && entry.type!="SECTION" && entry.type!="HELPHEADTAIL" && entry.type!="CONFIG" && entry.type!="ENV"
+            && entry.type!="RANGE" && entry.type!="CHOICES" && entry.type!="PATTERN"
+            && entry.type!="REQUIRES" && entry.type!="CONFLICTS" && entry.type!="ONEOF" && entry.type!="ATLEASTONE") {
+        throw std::runtime_error("Unknown schema entry '" + entry.type + "'.");
+    }
+    const bool isRule = entry.type=="REQUIRES" || entry.type=="CONFLICTS" || entry.type=="ONEOF" || entry.type=="ATLEASTONE";
+    if((entry.type=="RANGE" && entry.names.size()!=3) || ((entry.type=="CHOICES" || isRule) && entry.names.size()<2) || (entry.type=="PATTERN" && entry.names.size()!=2)) {
+        throw std::runtime_error("The schema entry '" + line + "' has a wrong number of fields.");
+    }
+    if(entry.names.empty()) {
+        throw std::runtime_error("The schema entry '" + line + "' misses a name.");
+    }
+    if(entry.type=="ENUM" && entry.choices.empty()) {
+        throw std::runtime_error("The enum option '" + entry.names[0] + "' has no choices.");
+    }
+    if(entry.type=="CONFIG") {
+        myConfigOptionName = entry.names[0];
+    }
+    if(entry.type=="ENV") {
+        myEnvPrefix = entry.names[0];
+    }
+    myEntries.push_back(entry);
+}
+
+
+void
+OptionsSchema::fill(OptionsCont &into) const {
+    for(std::vector<Entry>::const_iterator i=myEntries.begin(); i!=myEntries.end(); ++i) {
+        const Entry &entry = *i;
+        if(entry.type=="HELPHEADTAIL") {
+            into.setHelpHeadAndTail(entry.names[0], entry.names.size()>1 ? entry.names[1] : "");
+            continue;
+        }
+        if(entry.type=="SECTION") {
+            into.beginSection(entry.names[0]);
+            continue;
+        }
+        if(entry.type=="CONFIG" || entry.type=="ENV") {
+            continue;
+        }
+        if(entry.type=="RANGE" || entry.type=="CHOICES" || entry.type=="PATTERN") {
+            // constrain an option defined before
+            const std::string &name = entry.names[0];
+            if(!into.contains(name)) {
+                throw std::runtime_error("The option '" + name + "' to constrain is not known.");
+            }
+            if(entry.type=="RANGE") {
+                into.addConstraint(name, new OptionsRangeConstraint(atof(entry.names[1].c_str()), atof(entry.names[2].c_str())));
+            } else if(entry.type=="CHOICES") {
+                into.addConstraint(name, new OptionsChoicesConstraint(std::vector<std::string>(entry.names.begin()+1, entry.names.end())));
+            } else {
+                into.addConstraint(name, new OptionsPatternConstraint(entry.names[1]));
+            }
+            continue;
+        }
+        if(entry.type=="REQUIRES") {
+            into.addRequires(entry.names[0], std::vector<std::string>(entry.names.begin()+1, entry.names.end()));
+            continue;
+        }
+        if(entry.type=="CONFLICTS") {
+            into.addConflicts(entry.names);
+            continue;
+        }
+        if(entry.type=="ONEOF") {
+            into.addOneOf(entry.names);
+            continue;
+        }
+        if(entry.type=="ATLEASTONE") {
+            into.addAtLeastOne(entry.names);
+            continue;
+        }
+        // build the option
+        const bool hasDefault = entry.defaultValue.length()!=0;
+        Option *option = 0;
+        if(entry.type=="INT") {
+            option = hasDefault ? new Option_Integer(atoi(entry.defaultValue.c_str())) : new Option_Integer();
+        } else if(entry.type=="LONG") {
+            long long value = 0;
+            try {
+                if(hasDefault) {
+                    OptionsConverter<long long>::parse(entry.defaultValue.data(), entry.defaultValue.length(), value);
+                }
+            } catch(std::runtime_error &e) {
+                throw std::runtime_error("Could not set the default of option '" + entry.names[0] + "'; reason: " + e.what());
+            }
+            option = hasDefault ? new Option_Typed<long long>(value) : new Option_Typed<long long>();
+        } else if(entry.type=="DOUBLE") {
+            option = hasDefault ? new Option_Double(atof(entry.defaultValue.c_str())) : new Option_Double();
+        } else if(entry.type=="BOOL") {
+            option = new Option_Bool();
+        } else if(entry.type=="STRING") {
+            option = hasDefault ? new Option_String(entry.defaultValue) : new Option_String();
+        } else if(entry.type=="ENUM") {
+            try {
+                option = hasDefault ? new Option_Enum(entry.choices, entry.defaultValue) : new Option_Enum(entry.choices);
+            } catch(std::runtime_error &e) {
+                throw std::runtime_error("Could not set the default of option '" + entry.names[0] + "'; reason: " + e.what());
+            }
+        } else {
+            option = hasDefault ? new Option_FileName(entry.defaultValue) : new Option_FileName();
+        }
+        // add it using its names
+        const std::string &name = entry.names[0];
+        if(entry.abbr!=0) {
+            into.add(name, entry.abbr, option);
+        } else {
+            into.add(name, option);
+        }
+        for(std::vector<std::string>::const_iterator j=entry.names.begin()+1; j!=entry.names.end(); ++j) {
+            into.addSynonym(name, *j);
+        }
+        if(entry.description.length()!=0) {
+            into.setDescription(name, entry.description);
+        }
+    }
+}
+
+
+const std::vector<OptionsSchema::Entry> &
+OptionsSchema::getEntries() const {
+    return myEntries;
+}
+
+
+const std::string &
+OptionsSchema::getConfigOptionName() const {
+    return myConfigOptionName;
+}
+
+
+const std::string &
+OptionsSchema::getEnvPrefix() const {
+    return myEnvPrefix;
+}
+
+
+bool
+OptionsSchema::isOptionType(const std::string &type) {
+    return type=="INT" || type=="LONG" || type=="DOUBLE" || type=="BOOL" || type=="STRING" || type=="FILE" || type=="ENUM";
+}
+
+
+// *************************************************************************
@@ -0,0 +1,194 @@
+#ifndef OptionsSchema_h
+#define OptionsSchema_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsSchema.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class OptionsCont;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsSchema
+ * @brief A definition of options, read from a schema file
+ *
+ * A schema consists of lines; each line holds ';'-separated fields, the
+ *  first one being the line's type:
+ * @arg INT, LONG, DOUBLE, BOOL, STRING, FILE, ENUM: an option of the respective type
+ *  (LONG options are typed options holding a long long, see Option_Typed);
+ *  the following fields are the option's names (the first being its name,
+ *  the others synonyms), a single character is its abbreviation, a field
+ *  starting with '+' is its default value, one starting with '!' its
+ *  description; each field starting with '=' names a literal an ENUM
+ *  option accepts (see Option_Enum)
+ * @arg SECTION;NAME: begins a section of the help screen
+ * @arg HELPHEADTAIL;HEAD;TAIL: the head and the (optional) tail of the help screen
+ * @arg CONFIG;NAME: the name of the option that names the configuration
+ * @arg ENV;PREFIX: the prefix of the environment variables options are read from
+ * @arg RANGE;NAME;MIN;MAX: the named option accepts numbers between MIN and MAX only
+ * @arg CHOICES;NAME;VALUE1;VALUE2...: the named option accepts the given values only
+ * @arg PATTERN;NAME;REGEX: the named option accepts values matching REGEX only
+ *
+ * @arg REQUIRES;NAME;REQUIRED1;REQUIRED2...: if the named option is given, the required ones must be given as well
+ * @arg CONFLICTS;NAME1;NAME2...: at most one of the named options may be given
+ * @arg ONEOF;NAME1;NAME2...: exactly one of the named options must be given
+ * @arg ATLEASTONE;NAME1;NAME2...: at least one of the named options must be given
+ *
+ * Constraints (see OptionsConstraint.h) and rules (see OptionsCont::addRequires)
+ *  are given after the options they refer to.
+ *
+ * Lines without a ';' are ignored.
+ *
+ * The schema builds the options of a container (see fill). The
+ *  options_generator application turns a schema into a header with a
+ *  struct holding the options' values as typed members.
+ */
+class OptionsSchema {
+public:
+    /**
+     * @struct Entry
+     * @brief A line of the schema
+     */
+    struct Entry {
+        /// @brief The type of the line ("INT", "SECTION", ...)
+        std::string type;
+
+        /// @brief The option's names (name first) or the line's other fields
+        std::vector<std::string> names;
+
+        /// @brief The option's abbreviation, 0 if not given
+        char abbr;
+
+        /// @brief The option's default value, empty if not given
+        std::string defaultValue;
+
+        /// @brief The option's description
+        std::string description;
+
+        /// @brief The literals an enum option accepts
+        std::vector<std::string> choices;
+    };
+
+
+    /// @brief Constructor
+    OptionsSchema();
+
+
+    /// @brief Destructor
+    ~OptionsSchema();
+
+
+    /** @brief Reads the schema from the named file
+     * @param[in] fileName The name of the file to read
+     * @return Whether the file could be read
+     * @throw runtime_error If a line is not valid
+     */
+    bool read(const std::string &fileName);
+
+
+    /** @brief Adds the given lines
+     * @param[in] lines The lines to add, terminated by 0
+     * @throw runtime_error If a line is not valid
+     */
+    void add(const char * const *lines);
+
+
+    /** @brief Adds a line
+     * @param[in] line The line to add
+     * @throw runtime_error If the line is not valid
+     */
+    void addLine(const std::string &line);
+
+
+    /** @brief Builds the defined options in the given container
+     * @param[in] into The container to add the options to
+     * @throw runtime_error If the default of an enum option is not one of its literals or an option a constraint or a rule refers to is not known
+     */
+    void fill(OptionsCont &into) const;
+
+
+    /** @brief Returns the schema's lines
+     * @return The entries in the order they were read
+     */
+    const std::vector<Entry> &getEntries() const;
+
+
+    /** @brief Returns the name of the option that names the configuration
+     * @return The name of the configuration option, empty if not given
+     */
+    const std::string &getConfigOptionName() const;
+
+
+    /** @brief Returns the prefix of the environment variables to read options from
+     * @return The prefix, empty if options shall not be read from the environment
+     */
+    const std::string &getEnvPrefix() const;
+
+
+    /** @brief Returns whether the given type names an option type
+     * @param[in] type The type of a line
+     * @return Whether a line of this type defines an option
+     */
+    static bool isOptionType(const std::string &type);
+
+
+private:
+    /// @brief The schema's lines
+    std::vector<Entry> myEntries;
+
+    /// @brief The name of the option that names the configuration
+    std::string myConfigOptionName;
+
+    /// @brief The prefix of the environment variables to read options from
+    std::string myEnvPrefix;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsSchema(const OptionsSchema &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsSchema &operator=(const OptionsSchema &s);
+
+
+};
+
+
+// *************************************************************************
+#endif
@@ -0,0 +1,495 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsSnapshot.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <fstream>
+#if !defined _MSC_VER && !defined __BORLANDC__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "Option.h"
+#include "OptionsCont.h"
+#include "OptionsFileWriter.h"
+#include "OptionsSnapshot.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * definitions
+ * ======================================================================= */
+/// @brief The types of the values stored in an image
+enum SnapshotValueType {
+    SNAPSHOT_INTEGER = 0,
+    SNAPSHOT_DOUBLE = 1,
+    SNAPSHOT_BOOL = 2,
+    SNAPSHOT_STRING = 3
+};
+
+
+/// @brief Flag of an entry whose option is set
+#define SNAPSHOT_SET 1
+
+/// @brief Flag of an entry whose option has its default value
+#define SNAPSHOT_DEFAULT 2
+
+/// @brief The version of the image layout
+#define SNAPSHOT_VERSION 1
+
+
+/**
+ * @struct SnapshotHeader
+ * @brief The begin of an image (64 bytes)
+ */
+struct SnapshotHeader {
+    /// @brief The magic bytes "OPTSNAP"
+    char magic[8];
+
+    /// @brief The version of the layout
+    uint32_t version;
+
+    /// @brief The number of options (entries)
+    uint32_t optionNumber;
+
+    /// @brief The number of names (index entries)
+    uint32_t nameNumber;
+
+    /// @brief Unused
+    uint32_t reserved;
+
+    /// @brief The generation of the image
+    uint64_t generation;
+
+    /// @brief The fingerprint of the options
+    uint64_t fingerprint;
+
+    /// @brief The size of the image in bytes
+    uint64_t size;
+
+    /// @brief The generation of the image that replaced this one, 0 while current
+    std::atomic<uint64_t> superseded;
+
+    /// @brief Unused
+    uint64_t padding;
+};
+
+
+/**
+ * @struct SnapshotEntry
+ * @brief The value of an option (24 bytes, stored by option ID)
+ */
+struct SnapshotEntry {
+    /// @brief The offset of the (0-terminated) string value
+    uint32_t stringOffset;
+
+    /// @brief The value's type (see SnapshotValueType)
+    uint8_t type;
+
+    /// @brief SNAPSHOT_SET and SNAPSHOT_DEFAULT
+    uint8_t flags;
+
+    /// @brief Unused
+    uint16_t reserved;
+
+    /// @brief The integer or bool value
+    int64_t integerValue;
+
+    /// @brief The double value
+    double doubleValue;
+};
+
+
+/**
+ * @struct SnapshotName
+ * @brief A name of an option (stored sorted by name)
+ */
+struct SnapshotName {
+    /// @brief The offset of the (0-terminated) name
+    uint32_t nameOffset;
+
+    /// @brief The ID of the option
+    uint32_t id;
+};
+
+
+
+/* =========================================================================
+ * static helper definitions
+ * ======================================================================= */
+/** @brief Returns whether the given data is a complete image
+ *
+ * The header's numbers, the entries' string offsets, and the names' offsets
+ *  and IDs must lie within the image, and the strings must be terminated
+ *  within it, so that reading the image never leaves the mapped memory.
+ * @param[in] data The image
+ * @param[in] size The size of the image in bytes
+ * @return Whether the image is valid
+ */
+static bool
+isValidImage(const char *data, size_t size) {
+    const SnapshotHeader *header = (const SnapshotHeader*) data;
+    if(memcmp(header->magic, "OPTSNAP", 8)!=0 || header->version!=SNAPSHOT_VERSION || header->size!=size) {
+        return false;
+    }
+    // the tables must fit (divided, so that nothing overflows)
+    size_t rest = size - sizeof(SnapshotHeader);
+    if(header->optionNumber>rest/sizeof(SnapshotEntry)) {
+        return false;
+    }
+    rest -= header->optionNumber * sizeof(SnapshotEntry);
+    if(header->nameNumber>rest/sizeof(SnapshotName)) {
+        return false;
+    }
+    // the strings follow the tables; the last one is terminated by the image's last byte
+    const size_t stringsOffset = size - rest + header->nameNumber * sizeof(SnapshotName);
+    if(stringsOffset<size && data[size-1]!='\0') {
+        return false;
+    }
+    const SnapshotEntry *entries = (const SnapshotEntry*) (data + sizeof(SnapshotHeader));
+    for(uint32_t i=0; i<header->optionNumber; ++i) {
+        if((entries[i].flags&SNAPSHOT_SET)!=0 && (entries[i].stringOffset<stringsOffset || entries[i].stringOffset>=size)) {
+            return false;
+        }
+    }
+    const SnapshotName *names = (const SnapshotName*) (entries + header->optionNumber);
+    for(uint32_t i=0; i<header->nameNumber; ++i) {
+        if(names[i].id>=header->optionNumber || names[i].nameOffset<stringsOffset || names[i].nameOffset>=size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+OptionsSnapshot::OptionsSnapshot()
+    : myData(0), mySize(0), myAmMapped(false) {
+}
+
+
+OptionsSnapshot::~OptionsSnapshot() {
+    detach();
+}
+
+
+bool
+OptionsSnapshot::publish(const OptionsCont &options, const std::string &fileName) {
+    // lay out the image: header, entries, names, strings
+    const size_t optionNumber = options.getOptionNumber();
+    std::vector<std::string> names = options.getAllOptionNames();
+    const size_t namesOffset = sizeof(SnapshotHeader) + optionNumber * sizeof(SnapshotEntry);
+    const size_t stringsOffset = namesOffset + names.size() * sizeof(SnapshotName);
+    std::string image(stringsOffset, '\0');
+    for(size_t i=0; i<optionNumber; ++i) {
+        const Option &option = options.getOptionAt(i);
+        SnapshotEntry entry;
+        memset(&entry, 0, sizeof(entry));
+        entry.flags = (option.isSet() ? SNAPSHOT_SET : 0) | (option.isDefault() ? SNAPSHOT_DEFAULT : 0);
+        if(dynamic_cast<const Option_Bool*>(&option)!=0) {
+            entry.type = SNAPSHOT_BOOL;
+            entry.integerValue = option.isSet() && static_cast<const Option_Bool&>(option).getValue() ? 1 : 0;
+        } else if(dynamic_cast<const Option_Integer*>(&option)!=0) {
+            entry.type = SNAPSHOT_INTEGER;
+            entry.integerValue = option.isSet() ? static_cast<const Option_Integer&>(option).getValue() : 0;
+        } else if(dynamic_cast<const Option_TunableInteger*>(&option)!=0) {
+            entry.type = SNAPSHOT_INTEGER;
+            entry.integerValue = static_cast<const Option_TunableInteger&>(option).getValue();
+        } else if(dynamic_cast<const Option_Double*>(&option)!=0) {
+            entry.type = SNAPSHOT_DOUBLE;
+            entry.doubleValue = option.isSet() ? static_cast<const Option_Double&>(option).getValue() : 0;
+        } else if(dynamic_cast<const Option_TunableDouble*>(&option)!=0) {
+            entry.type = SNAPSHOT_DOUBLE;
+            entry.doubleValue = static_cast<const Option_TunableDouble&>(option).getValue();
+        } else {
+            entry.type = SNAPSHOT_STRING;
+        }
+        if(option.isSet()) {
+            entry.stringOffset = (uint32_t) image.length();
+            image.append(option.getValueAsString());
+            image.push_back('\0');
+        }
+        memcpy(&image[sizeof(SnapshotHeader) + i * sizeof(SnapshotEntry)], &entry, sizeof(entry));
+    }
+    // the names are sorted already (see getAllOptionNames)
+    for(size_t i=0; i<names.size(); ++i) {
+        SnapshotName name;
+        name.nameOffset = (uint32_t) image.length();
+        name.id = (uint32_t) options.getOptionID(names[i]);
+        image.append(names[i]);
+        image.push_back('\0');
+        memcpy(&image[namesOffset + i * sizeof(SnapshotName)], &name, sizeof(name));
+    }
+    // the header is filled in place; the zeroed image marks it as current
+    SnapshotHeader *header = (SnapshotHeader*) &image[0];
+    memcpy(header->magic, "OPTSNAP", 8);
+    header->version = SNAPSHOT_VERSION;
+    header->optionNumber = (uint32_t) optionNumber;
+    header->nameNumber = (uint32_t) names.size();
+    header->fingerprint = options.getSchemaFingerprint();
+    header->size = image.length();
+    // continue the generation of the published image
+    OptionsSnapshot previous;
+    header->generation = previous.attach(fileName) ? previous.getGeneration() + 1 : 1;
+    previous.detach();
+    const uint64_t generation = header->generation;
+#if !defined _MSC_VER && !defined __BORLANDC__
+    // keep the previous image open for marking it as superseded
+    int fd = open(fileName.c_str(), O_RDWR);
+#endif
+    OptionsFileWriter writer(image.length());
+    writer.append(image);
+    if(!writer.writeAtomically(fileName)) {
+#if !defined _MSC_VER && !defined __BORLANDC__
+        if(fd>=0) {
+            close(fd);
+        }
+#endif
+        return false;
+    }
+#if !defined _MSC_VER && !defined __BORLANDC__
+    if(fd>=0) {
+        void *data = mmap(0, sizeof(SnapshotHeader), PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+        if(data!=MAP_FAILED) {
+            SnapshotHeader *old = (SnapshotHeader*) data;
+            if(memcmp(old->magic, "OPTSNAP", 8)==0) {
+                old->superseded.store(generation, std::memory_order_release);
+            }
+            munmap(data, sizeof(SnapshotHeader));
+        }
+        close(fd);
+    }
+#endif
+    return true;
+}
+
+
+bool
+OptionsSnapshot::attach(const std::string &fileName) {
+    detach();
+#if !defined _MSC_VER && !defined __BORLANDC__
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if(fd<0) {
+        return false;
+    }
+    struct stat st;
+    if(fstat(fd, &st)!=0 || (size_t) st.st_size<sizeof(SnapshotHeader)) {
+        close(fd);
+        return false;
+    }
+    void *data = mmap(0, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(data==MAP_FAILED) {
+        return false;
+    }
+    myData = (const char*) data;
+    mySize = (size_t) st.st_size;
+    myAmMapped = true;
+#else
+    std::ifstream fdi(fileName.c_str(), std::ios::in|std::ios::binary);
+    if(!fdi.good()) {
+        return false;
+    }
+    fdi.seekg(0, std::ios::end);
+    mySize = (size_t) fdi.tellg();
+    fdi.seekg(0, std::ios::beg);
+    if(mySize<sizeof(SnapshotHeader)) {
+        mySize = 0;
+        return false;
+    }
+    char *data = new char[mySize];
+    fdi.read(data, mySize);
+    myData = data;
+#endif
+    if(!isValidImage(myData, mySize)) {
+        detach();
+        return false;
+    }
+    return true;
+}
+
+
+void
+OptionsSnapshot::detach() {
+    if(myData!=0) {
+#if !defined _MSC_VER && !defined __BORLANDC__
+        if(myAmMapped) {
+            munmap((void*) myData, mySize);
+        } else {
+            delete[] myData;
+        }
+#else
+        delete[] myData;
+#endif
+    }
+    myData = 0;
+    mySize = 0;
+    myAmMapped = false;
+}
+
+
+bool
+OptionsSnapshot::isCurrent() const {
+    return myData!=0 && ((const SnapshotHeader*) myData)->superseded.load(std::memory_order_acquire)==0;
+}
+
+
+unsigned long long
+OptionsSnapshot::getGeneration() const {
+    return myData!=0 ? ((const SnapshotHeader*) myData)->generation : 0;
+}
+
+
+unsigned long long
+OptionsSnapshot::getSchemaFingerprint() const {
+    return myData!=0 ? ((const SnapshotHeader*) myData)->fingerprint : 0;
+}
+
+
+
+/* -------------------------------------------------------------------------
+ * Retrieving Option Values
+ * ----------------------------------------------------------------------- */
+bool
+OptionsSnapshot::contains(const std::string &name) const {
+    return find(name)!=0;
+}
+
+
+bool
+OptionsSnapshot::isSet(const std::string &name) const {
+    const SnapshotEntry *entry = (const SnapshotEntry*) find(name);
+    if(entry==0) {
+        throw std::runtime_error("Option '" + name + "' is not known.");
+    }
+    return (entry->flags&SNAPSHOT_SET)!=0;
+}
+
+
+int
+OptionsSnapshot::getInteger(const std::string &name) const {
+    return (int) ((const SnapshotEntry*) get(name, SNAPSHOT_INTEGER, "an integer"))->integerValue;
+}
+
+
+double
+OptionsSnapshot::getDouble(const std::string &name) const {
+    return ((const SnapshotEntry*) get(name, SNAPSHOT_DOUBLE, "a double"))->doubleValue;
+}
+
+
+bool
+OptionsSnapshot::getBool(const std::string &name) const {
+    return ((const SnapshotEntry*) get(name, SNAPSHOT_BOOL, "a bool"))->integerValue!=0;
+}
+
+
+const char *
+OptionsSnapshot::getString(const std::string &name) const {
+    return myData + ((const SnapshotEntry*) get(name, SNAPSHOT_STRING, "a string"))->stringOffset;
+}
+
+
+std::string
+OptionsSnapshot::getValueAsString(const std::string &name) const {
+    const SnapshotEntry *entry = (const SnapshotEntry*) find(name);
+    if(entry==0) {
+        throw std::runtime_error("Option '" + name + "' is not known.");
+    }
+    if((entry->flags&SNAPSHOT_SET)==0) {
+        throw std::runtime_error("The option '" + name + "' is not set!");
+    }
+    return myData + entry->stringOffset;
+}
+
+
+
+/* -------------------------------------------------------------------------
+ * Private helper methods
+ * ----------------------------------------------------------------------- */
+const void *
+OptionsSnapshot::find(const std::string &name) const {
+    if(myData==0) {
+        return 0;
+    }
+    const SnapshotHeader *header = (const SnapshotHeader*) myData;
+    const SnapshotEntry *entries = (const SnapshotEntry*) (myData + sizeof(SnapshotHeader));
+    const SnapshotName *names = (const SnapshotName*) (entries + header->optionNumber);
+    // binary search within the sorted names
+    size_t beg = 0;
+    size_t end = header->nameNumber;
+    while(beg<end) {
+        size_t mid = (beg + end) / 2;
+        int cmp = strcmp(myData + names[mid].nameOffset, name.c_str());
+        if(cmp==0) {
+            return entries + names[mid].id;
+        } else if(cmp<0) {
+            beg = mid + 1;
+        } else {
+            end = mid;
+        }
+    }
+    return 0;
+}
+
+
+const void *
+OptionsSnapshot::get(const std::string &name, int type, const std::string &typeName) const {
+    const SnapshotEntry *entry = (const SnapshotEntry*) find(name);
+    if(entry==0) {
+        throw std::runtime_error("Option '" + name + "' is not known.");
+    }
+    if(entry->type!=type) {
+        throw std::runtime_error("Option '" + name + "' is not " + typeName + " option!");
+    }
+    if((entry->flags&SNAPSHOT_SET)==0) {
+        throw std::runtime_error("The option '" + name + "' is not set!");
+    }
+    return entry;
+}
+
+
+// *************************************************************************
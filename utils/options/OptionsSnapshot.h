@@ -0,0 +1,212 @@
+#ifndef OptionsSnapshot_h
+#define OptionsSnapshot_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsSnapshot.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <cstddef>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class OptionsCont;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsSnapshot
+ * @brief A read-only, memory-mapped image of an options container's values
+ *
+ * A process publishes the values of its options into a file using
+ *  publish(); a file in /dev/shm is a POSIX shared memory segment. Other
+ *  processes attach to it and read the values in place: the image uses
+ *  offsets only, the names are kept in a sorted index, so nothing is
+ *  parsed or copied when attaching.
+ *
+ * Publishing again writes a new image with the next generation number and
+ *  replaces the file atomically; the previous image is marked as superseded.
+ *  Attached readers keep reading the previous image until they notice that
+ *  it is not current any more (see isCurrent) and attach again.
+ *
+ * The image is meant for processes on the same machine; it uses the
+ *  machine's byte order. On systems without mmap, the image is read into
+ *  memory and updates are not noticed.
+ */
+class OptionsSnapshot {
+public:
+    /// @brief Constructor
+    OptionsSnapshot();
+
+
+    /// @brief Destructor, detaches
+    ~OptionsSnapshot();
+
+
+    /** @brief Writes the values of the given options into the named file
+     * @param[in] options The options to publish
+     * @param[in] fileName The name of the file to write (e.g. "/dev/shm/myapp.options")
+     * @return Whether the image could be written
+     */
+    static bool publish(const OptionsCont &options, const std::string &fileName);
+
+
+    /** @brief Maps the image stored in the named file
+     * @param[in] fileName The name of the file to map
+     * @return Whether the file could be mapped and contains a valid image
+     */
+    bool attach(const std::string &fileName);
+
+
+    /// @brief Releases the mapped image
+    void detach();
+
+
+    /** @brief Returns whether the mapped image is the most recently published one
+     * @return Whether no newer image was published
+     */
+    bool isCurrent() const;
+
+
+    /** @brief Returns the generation of the mapped image
+     * @return The number of the publication, starting at 1
+     */
+    unsigned long long getGeneration() const;
+
+
+    /** @brief Returns the fingerprint of the options the image was built from
+     * @return The options' fingerprint (see OptionsCont::getSchemaFingerprint)
+     */
+    unsigned long long getSchemaFingerprint() const;
+
+
+    /// @brief Retrieving Option Values
+    /// @{
+
+    /** @brief Returns whether the named option is known
+     * @param[in] name The name of the option
+     * @return Whether the option is known
+     */
+    bool contains(const std::string &name) const;
+
+
+    /** @brief Returns whether the named option is set
+     * @param[in] name The name of the option
+     * @return Whether the option has a value set
+     */
+    bool isSet(const std::string &name) const;
+
+
+    /** @brief Returns the integer value of the named option
+     * @param[in] name The name of the option
+     * @return The named option's value
+     * @throw runtime_error If the option is not known, not an integer option, or not set
+     */
+    int getInteger(const std::string &name) const;
+
+
+    /** @brief Returns the double value of the named option
+     * @param[in] name The name of the option
+     * @return The named option's value
+     * @throw runtime_error If the option is not known, not a double option, or not set
+     */
+    double getDouble(const std::string &name) const;
+
+
+    /** @brief Returns the boolean value of the named option
+     * @param[in] name The name of the option
+     * @return The named option's value
+     * @throw runtime_error If the option is not known, not a bool option, or not set
+     */
+    bool getBool(const std::string &name) const;
+
+
+    /** @brief Returns the string value of the named option
+     * @param[in] name The name of the option
+     * @return The named option's value (0-terminated, stored in the image)
+     * @throw runtime_error If the option is not known, not a string option, or not set
+     */
+    const char *getString(const std::string &name) const;
+
+
+    /** @brief Returns the value of the named option as a string
+     * @param[in] name The name of the option
+     * @return The string representation of the option's value
+     * @throw runtime_error If the option is not known or not set
+     */
+    std::string getValueAsString(const std::string &name) const;
+    /// @}
+
+
+private:
+    /** @brief Returns the image's entry of the named option
+     * @param[in] name The name of the option
+     * @return The option's entry, 0 if the option is not known
+     */
+    const void *find(const std::string &name) const;
+
+
+    /** @brief Returns the image's entry of the named option, checking its type
+     * @param[in] name The name of the option
+     * @param[in] type The expected type
+     * @param[in] typeName The type's name for reporting
+     * @return The option's entry
+     * @throw runtime_error If the option is not known, has a different type, or is not set
+     */
+    const void *get(const std::string &name, int type, const std::string &typeName) const;
+
+
+private:
+    /// @brief The mapped image
+    const char *myData;
+
+    /// @brief The size of the mapped image
+    size_t mySize;
+
+    /// @brief Whether the image is mapped (or allocated)
+    bool myAmMapped;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsSnapshot(const OptionsSnapshot &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsSnapshot &operator=(const OptionsSnapshot &s);
+
+
+};
+
+
+// *************************************************************************
+#endif
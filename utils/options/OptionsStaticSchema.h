@@ -0,0 +1,1005 @@
+#ifndef OptionsStaticSchema_h
+#define OptionsStaticSchema_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsStaticSchema.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <type_traits>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include "Option.h"
+#include "OptionsHash.h"
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * definitions
+ * ======================================================================= */
+/** @brief Declares an option of a compile-time schema
+ *
+ * The names are given as in schema files: separated by ';', the first one
+ *  being the option's name; single characters are abbreviations.
+ * @param[in] Tag The name of the type declaring the option
+ * @param[in] Type The option's type (int, double, bool, or std::string)
+ * @param[in] Names The option's names, e.g. "threads;j;jobs"
+ * @param[in] Default The option's default value
+ */
+#define OPTIONS_STATIC_OPTION(Tag, Type, Names, Default) \
+    struct Tag { \
+        typedef Type value_type; \
+        static constexpr const char *names() { return Names; } \
+        static value_type defaultValue() { return Default; } \
+    }
+
+/// @brief The key of an option name, used for accessing a compile-time schema's values
+#define OPTIONS_KEY(name) OptionsStaticNames::hash(name)
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsStaticNames
+ * @brief Compile-time helpers for hashing and splitting ';'-separated option names
+ */
+class OptionsStaticNames {
+public:
+    /** @brief Hashes the given (0-terminated) name
+     * @param[in] s The name to hash
+     * @param[in] hash The hash to continue
+     * @return The name's FNV-1a hash (as OptionsHash::fnv1a)
+     */
+    static constexpr unsigned long long hash(const char *s, unsigned long long hash=OptionsHash::OFFSET_BASIS) {
+        return *s==0 ? hash : OptionsStaticNames::hash(s+1, (hash ^ (unsigned char) *s) * OptionsHash::PRIME);
+    }
+
+
+    /** @brief Hashes the name at the begin of the given names
+     * @param[in] s The names, the first one ending at ';' or at the end
+     * @param[in] hash The hash to continue
+     * @return The first name's FNV-1a hash
+     */
+    static constexpr unsigned long long hashFirst(const char *s, unsigned long long hash=OptionsHash::OFFSET_BASIS) {
+        return *s==0 || *s==';' ? hash : hashFirst(s+1, (hash ^ (unsigned char) *s) * OptionsHash::PRIME);
+    }
+
+
+    /** @brief Returns the number of the given names
+     * @param[in] s The ';'-separated names
+     * @return The number of names
+     */
+    static constexpr size_t count(const char *s) {
+        return *s==0 ? 1 : (*s==';' ? 1 : 0) + count(s+1);
+    }
+
+
+    /** @brief Returns the begin of the k-th name
+     * @param[in] s The ';'-separated names
+     * @param[in] k The index of the name
+     * @return The begin of the name
+     */
+    static constexpr const char *at(const char *s, size_t k) {
+        return k==0 ? s : at(skip(s)+1, k-1);
+    }
+
+
+    /** @brief Returns the end of the name at the begin of the given names
+     * @param[in] s The names
+     * @return The position of the first ';' or of the end
+     */
+    static constexpr const char *skip(const char *s) {
+        return *s==0 || *s==';' ? s : skip(s+1);
+    }
+
+
+    /** @brief Returns the sum of the given numbers
+     * @param[in] values The numbers
+     * @param[in] begin The index of the first number to add
+     * @param[in] end The index behind the last number to add
+     * @return The sum of the numbers within [begin, end)
+     */
+    static constexpr size_t sum(const size_t *values, size_t begin, size_t end) {
+        return end<=begin ? 0 : (end-begin==1 ? values[begin] : sum(values, begin, (begin+end)/2) + sum(values, (begin+end)/2, end));
+    }
+
+
+    /** @brief Returns the number of doubling steps needed to span the given number of entries
+     * @param[in] n The number of entries
+     * @return The smallest l with 2^l >= n
+     */
+    static constexpr size_t levels(size_t n) {
+        return n<=1 ? 0 : 1 + levels((n+1)/2);
+    }
+
+
+    /** @brief Scrambles a hash using a seed (the finaliser of splitmix64)
+     * @param[in] hash The hash to scramble
+     * @param[in] seed The seed
+     * @return The scrambled hash
+     */
+    static constexpr unsigned long long scramble(unsigned long long hash, unsigned long long seed) {
+        return xorShift(xorShift(xorShift(hash ^ (seed * 0x9E3779B97F4A7C15ULL), 30) * 0xBF58476D1CE4E5B9ULL, 27) * 0x94D049BB133111EBULL, 31);
+    }
+
+
+    /** @brief Returns whether the given name is the first of the given names
+     * @param[in] name The (0-terminated) name to compare
+     * @param[in] s The names
+     * @return Whether the name equals the first of the names
+     */
+    static bool equals(const char *name, const char *s) {
+        for(; *name!=0 && *s!=0 && *s!=';'; ++name, ++s) {
+            if(*name!=*s) {
+                return false;
+            }
+        }
+        return *name==0 && (*s==0 || *s==';');
+    }
+
+
+
+private:
+    /// @brief Returns the value xor-ed with itself shifted to the right
+    static constexpr unsigned long long xorShift(unsigned long long value, unsigned int shift) {
+        return value ^ (value >> shift);
+    }
+
+
+};
+
+
+/**
+ * @struct OptionsIndexSequence
+ * @brief A sequence of indices for expanding tables (std::index_sequence is C++14)
+ */
+template<size_t... Is> struct OptionsIndexSequence { };
+
+/// @brief Concatenates two sequences, shifting the second one
+template<class A, class B> struct OptionsConcatIndices;
+template<size_t... As, size_t... Bs> struct OptionsConcatIndices<OptionsIndexSequence<As...>, OptionsIndexSequence<Bs...> > {
+    typedef OptionsIndexSequence<As..., (sizeof...(As)+Bs)...> type;
+};
+
+/// @brief Builds the sequence 0..N-1 (with logarithmic instantiation depth)
+template<size_t N> struct OptionsMakeIndices {
+    typedef typename OptionsConcatIndices<typename OptionsMakeIndices<N/2>::type, typename OptionsMakeIndices<N-N/2>::type>::type type;
+};
+template<> struct OptionsMakeIndices<0> {
+    typedef OptionsIndexSequence<> type;
+};
+template<> struct OptionsMakeIndices<1> {
+    typedef OptionsIndexSequence<0> type;
+};
+
+
+/**
+ * @struct OptionsStaticOptionNames
+ * @brief The names of a compile-time schema's options and their numbers
+ */
+template<class... Options> struct OptionsStaticOptionNames {
+    /// @brief The ';'-separated names of each option
+    static constexpr const char *names[sizeof...(Options)] = { Options::names()... };
+
+    /// @brief The number of names of each option
+    static constexpr size_t counts[sizeof...(Options)] = { OptionsStaticNames::count(Options::names())... };
+};
+template<class... Options> constexpr const char *OptionsStaticOptionNames<Options...>::names[sizeof...(Options)];
+template<class... Options> constexpr size_t OptionsStaticOptionNames<Options...>::counts[sizeof...(Options)];
+
+
+/**
+ * @struct OptionsStaticScan
+ * @brief The sums of the numbers before each entry, computed once
+ *
+ * Level 0 holds the numbers given by Source::valueAt shifted by one entry;
+ *  each further level adds the entry 2^(level-1) entries before, so that
+ *  each level is computed in a single pass over the previous one.
+ */
+template<class Source, size_t Level, class Indices> struct OptionsStaticScan;
+template<class Source, size_t Level, size_t... Is> struct OptionsStaticScan<Source, Level, OptionsIndexSequence<Is...> > {
+    /// @brief The previous level
+    typedef OptionsStaticScan<Source, Level-1, OptionsIndexSequence<Is...> > Previous;
+
+    /// @brief The partial sums
+    static constexpr size_t values[sizeof...(Is)] = {
+        (Previous::values[Is] + (Is>=((size_t) 1<<(Level-1)) ? Previous::values[Is-((size_t) 1<<(Level-1))] : 0))...
+    };
+};
+template<class Source, size_t... Is> struct OptionsStaticScan<Source, 0, OptionsIndexSequence<Is...> > {
+    /// @brief The numbers, shifted by one entry
+    static constexpr size_t values[sizeof...(Is)] = { (Is==0 ? 0 : Source::valueAt(Is-1))... };
+};
+template<class Source, size_t Level, size_t... Is> constexpr size_t OptionsStaticScan<Source, Level, OptionsIndexSequence<Is...> >::values[sizeof...(Is)];
+template<class Source, size_t... Is> constexpr size_t OptionsStaticScan<Source, 0, OptionsIndexSequence<Is...> >::values[sizeof...(Is)];
+
+
+/**
+ * @struct OptionsStaticNameTable
+ * @brief The names of a compile-time schema by name index, computed once
+ */
+template<class Layout, class Indices> struct OptionsStaticNameTable;
+template<class Layout, size_t... Is> struct OptionsStaticNameTable<Layout, OptionsIndexSequence<Is...> > {
+    /// @brief The begin of each name
+    static constexpr const char *names[sizeof...(Is)] = { Layout::computeName(Is)... };
+
+    /// @brief The index of the option each name belongs to
+    static constexpr size_t options[sizeof...(Is)] = { Layout::computeOption(Is)... };
+
+    /// @brief The hash of each name
+    static constexpr unsigned long long hashes[sizeof...(Is)] = { Layout::computeHash(Is)... };
+};
+template<class Layout, size_t... Is> constexpr const char *OptionsStaticNameTable<Layout, OptionsIndexSequence<Is...> >::names[sizeof...(Is)];
+template<class Layout, size_t... Is> constexpr size_t OptionsStaticNameTable<Layout, OptionsIndexSequence<Is...> >::options[sizeof...(Is)];
+template<class Layout, size_t... Is> constexpr unsigned long long OptionsStaticNameTable<Layout, OptionsIndexSequence<Is...> >::hashes[sizeof...(Is)];
+
+
+/**
+ * @struct OptionsStaticSorted
+ * @brief The name indices sorted by their bucket, computed once
+ *
+ * A merge sort: level 0 holds the name indices, each further level merges
+ *  pairs of the sorted runs of 2^(level-1) entries of the previous one.
+ */
+template<class Layout, size_t Level, class Indices> struct OptionsStaticSorted;
+template<class Layout, size_t Level, size_t... Is> struct OptionsStaticSorted<Layout, Level, OptionsIndexSequence<Is...> > {
+    /// @brief The name indices, sorted in runs of 2^level entries
+    static constexpr size_t values[sizeof...(Is)] = { Layout::template computeMerged<Level>(Is)... };
+};
+template<class Layout, size_t... Is> struct OptionsStaticSorted<Layout, 0, OptionsIndexSequence<Is...> > {
+    /// @brief The name indices
+    static constexpr size_t values[sizeof...(Is)] = { Is... };
+};
+template<class Layout, size_t Level, size_t... Is> constexpr size_t OptionsStaticSorted<Layout, Level, OptionsIndexSequence<Is...> >::values[sizeof...(Is)];
+template<class Layout, size_t... Is> constexpr size_t OptionsStaticSorted<Layout, 0, OptionsIndexSequence<Is...> >::values[sizeof...(Is)];
+
+
+/**
+ * @struct OptionsStaticBucketBegins
+ * @brief The position of each bucket's first name within the sorted names, computed once
+ */
+template<class Layout, class Indices> struct OptionsStaticBucketBegins;
+template<class Layout, size_t... Is> struct OptionsStaticBucketBegins<Layout, OptionsIndexSequence<Is...> > {
+    /// @brief The position of each bucket's first name, followed by the number of names
+    static constexpr size_t values[sizeof...(Is)] = { Layout::computeBucketBegin(Is)... };
+};
+template<class Layout, size_t... Is> constexpr size_t OptionsStaticBucketBegins<Layout, OptionsIndexSequence<Is...> >::values[sizeof...(Is)];
+
+
+/**
+ * @struct OptionsStaticBuckets
+ * @brief The buckets of the perfect hash table, computed once
+ *
+ * A bucket holding n names owns n*n slots; its seed scrambles the names'
+ *  hashes so that they are mapped onto distinct slots.
+ */
+template<class Layout, class Indices> struct OptionsStaticBuckets;
+template<class Layout, size_t... Is> struct OptionsStaticBuckets<Layout, OptionsIndexSequence<Is...> > {
+    /// @brief The number of slots of each bucket
+    static constexpr size_t slots[sizeof...(Is)] = { Layout::computeSlotNumber(Is)... };
+
+    /// @brief The seed of each bucket
+    static constexpr unsigned int seeds[sizeof...(Is)] = { Layout::computeSeed(Is)... };
+};
+template<class Layout, size_t... Is> constexpr size_t OptionsStaticBuckets<Layout, OptionsIndexSequence<Is...> >::slots[sizeof...(Is)];
+template<class Layout, size_t... Is> constexpr unsigned int OptionsStaticBuckets<Layout, OptionsIndexSequence<Is...> >::seeds[sizeof...(Is)];
+
+
+/**
+ * @struct OptionsStaticSlots
+ * @brief The perfect hash table of a compile-time schema, computed once
+ */
+template<class Layout, class Indices> struct OptionsStaticSlots;
+template<class Layout, size_t... Is> struct OptionsStaticSlots<Layout, OptionsIndexSequence<Is...> > {
+    /// @brief The name stored in each slot, 0 for empty slots
+    static constexpr const char *names[sizeof...(Is)] = { Layout::computeSlotName(Is)... };
+
+    /// @brief The index of the option the slot's name belongs to
+    static constexpr size_t options[sizeof...(Is)] = { Layout::computeSlotOption(Is)... };
+
+    /// @brief The hash of the slot's name
+    static constexpr unsigned long long hashes[sizeof...(Is)] = { Layout::computeSlotHash(Is)... };
+};
+template<class Layout, size_t... Is> constexpr const char *OptionsStaticSlots<Layout, OptionsIndexSequence<Is...> >::names[sizeof...(Is)];
+template<class Layout, size_t... Is> constexpr size_t OptionsStaticSlots<Layout, OptionsIndexSequence<Is...> >::options[sizeof...(Is)];
+template<class Layout, size_t... Is> constexpr unsigned long long OptionsStaticSlots<Layout, OptionsIndexSequence<Is...> >::hashes[sizeof...(Is)];
+
+
+/**
+ * @struct OptionsStaticSetters
+ * @brief The per-option functions of a compile-time schema, used when parsing
+ */
+template<class Schema, class Indices> struct OptionsStaticSetters;
+template<class Schema, size_t... Is> struct OptionsStaticSetters<Schema, OptionsIndexSequence<Is...> > {
+    /// @brief The function setting the option from a string
+    static void (* const setters[sizeof...(Is)])(Schema &, const std::string &);
+
+    /// @brief Whether the option is a bool option
+    static const bool isBool[sizeof...(Is)];
+};
+template<class Schema, size_t... Is> void (* const OptionsStaticSetters<Schema, OptionsIndexSequence<Is...> >::setters[sizeof...(Is)])(Schema &, const std::string &) = {
+    &Schema::template setFromString<Is>...
+};
+template<class Schema, size_t... Is> const bool OptionsStaticSetters<Schema, OptionsIndexSequence<Is...> >::isBool[sizeof...(Is)] = {
+    std::is_same<typename Schema::template OptionAt<Is>::value_type, bool>::value...
+};
+
+
+/**
+ * @struct OptionsStaticValue
+ * @brief The value of a compile-time schema's option
+ */
+template<size_t Index, class Option> struct OptionsStaticValue {
+    /// @brief Constructor, sets the default
+    OptionsStaticValue() : value(Option::defaultValue()) { }
+
+    /// @brief The option's value
+    typename Option::value_type value;
+};
+
+
+/**
+ * @struct OptionsStaticValues
+ * @brief The values of a compile-time schema's options
+ *
+ * Derives from one OptionsStaticValue per option instead of using a
+ *  std::tuple, whose recursive definition is slow to compile for many options.
+ */
+template<class Indices, class... Options> struct OptionsStaticValues;
+template<size_t... Is, class... Options> struct OptionsStaticValues<OptionsIndexSequence<Is...>, Options...> : OptionsStaticValue<Is, Options>... {
+    /// @brief Returns the value at the given index (Option is deduced)
+    template<size_t Index, class Option>
+    static OptionsStaticValue<Index, Option> &at(OptionsStaticValue<Index, Option> &value) {
+        return value;
+    }
+
+    /// @brief Returns the value at the given index (Option is deduced)
+    template<size_t Index, class Option>
+    static const OptionsStaticValue<Index, Option> &at(const OptionsStaticValue<Index, Option> &value) {
+        return value;
+    }
+
+    /// @brief Declares the option at the given index as the return type (used within decltype only)
+    template<size_t Index, class Option>
+    static Option optionAt(const OptionsStaticValue<Index, Option> *value);
+};
+
+
+/**
+ * @class OptionsStaticLayout
+ * @brief Compile-time computations over the names of a compile-time schema's options
+ *
+ * The names of all options are numbered consecutively ("name indices"),
+ *  synonyms following the option's name. Each computation fills an entry of
+ *  one of the tables above; the tables are computed once per schema, each
+ *  in a single pass over the previous ones, and are read directly when
+ *  parsing.
+ *
+ * The perfect hash table is built in two levels: the names are distributed
+ *  onto as many buckets as there are names by their hash; each bucket gets
+ *  n*n slots for its n names and the first seed that maps them onto distinct
+ *  slots. Since a bucket holds few names, a fitting seed is found after a
+ *  few tries, and the table has less than three slots per name on average.
+ */
+template<class... Options>
+class OptionsStaticLayout {
+public:
+    /// @brief The number of options
+    static const size_t OPTION_NUMBER = sizeof...(Options);
+
+    /// @brief The names of the options and their numbers
+    typedef OptionsStaticOptionNames<Options...> OptionNames;
+
+    /// @brief The number of names and synonyms (and of buckets)
+    static constexpr size_t NAME_NUMBER = OptionsStaticNames::sum(OptionNames::counts, 0, sizeof...(Options));
+
+    /// @brief The number of seeds tried per bucket
+    static constexpr unsigned int MAX_SEED = 1024;
+
+    /// @brief The indices of the names (and of the buckets)
+    typedef typename OptionsMakeIndices<NAME_NUMBER>::type NameIndices;
+
+    /// @brief The number of names of each option, summed up by FirstNames
+    struct NameCounts {
+        static constexpr size_t valueAt(size_t option) {
+            return OptionNames::counts[option];
+        }
+    };
+
+    /// @brief The number of slots of each bucket, summed up by Offsets
+    struct SlotCounts {
+        static constexpr size_t valueAt(size_t bucket) {
+            return Buckets::slots[bucket];
+        }
+    };
+
+    /// @brief The name index of each option's name, followed by the number of names
+    typedef OptionsStaticScan<NameCounts, OptionsStaticNames::levels(sizeof...(Options)+1), typename OptionsMakeIndices<sizeof...(Options)+1>::type> FirstNames;
+
+    /// @brief The names by name index
+    typedef OptionsStaticNameTable<OptionsStaticLayout, NameIndices> Names;
+
+    /// @brief The name indices sorted by bucket
+    typedef OptionsStaticSorted<OptionsStaticLayout, OptionsStaticNames::levels(NAME_NUMBER), NameIndices> Sorted;
+
+    /// @brief The position of each bucket's first name within Sorted
+    typedef OptionsStaticBucketBegins<OptionsStaticLayout, typename OptionsMakeIndices<NAME_NUMBER+1>::type> BucketBegins;
+
+    /// @brief The buckets of the perfect hash table
+    typedef OptionsStaticBuckets<OptionsStaticLayout, NameIndices> Buckets;
+
+    /// @brief The first slot of each bucket, followed by the number of slots
+    typedef OptionsStaticScan<SlotCounts, OptionsStaticNames::levels(NAME_NUMBER+1), typename OptionsMakeIndices<NAME_NUMBER+1>::type> Offsets;
+
+
+    /// @brief Computing the Tables
+    /// @{
+
+    /** @brief Returns the option a name belongs to
+     * @param[in] k The name index
+     * @return The index of the option
+     */
+    static constexpr size_t computeOption(size_t k) {
+        return findOption(k, 0, OPTION_NUMBER);
+    }
+
+
+    /** @brief Returns a name
+     * @param[in] k The name index
+     * @return The begin of the name
+     */
+    static constexpr const char *computeName(size_t k) {
+        return OptionsStaticNames::at(OptionNames::names[computeOption(k)], k-FirstNames::values[computeOption(k)]);
+    }
+
+
+    /** @brief Computes the hash of a name
+     * @param[in] k The name index
+     * @return The name's hash
+     */
+    static constexpr unsigned long long computeHash(size_t k) {
+        return OptionsStaticNames::hashFirst(computeName(k));
+    }
+
+
+    /** @brief Returns an entry of a level of the merge sort
+     * @tparam Level The level (> 0)
+     * @param[in] j The position of the entry
+     * @return The name index at this position after merging the runs of the previous level
+     */
+    template<size_t Level>
+    static constexpr size_t computeMerged(size_t j) {
+        return mergeRuns<Level>(j-j%((size_t) 2<<(Level-1)), j%((size_t) 2<<(Level-1)), (size_t) 1<<(Level-1));
+    }
+
+
+    /** @brief Returns the position of a bucket's first name within the sorted names
+     * @param[in] bucket The bucket (NAME_NUMBER for the number of names)
+     * @return The position of the first name whose bucket is not before the given one
+     */
+    static constexpr size_t computeBucketBegin(size_t bucket) {
+        return findBucketBegin(bucket, 0, NAME_NUMBER);
+    }
+
+
+    /** @brief Returns the number of slots of a bucket
+     * @param[in] bucket The bucket
+     * @return The square of the number of the bucket's names
+     */
+    static constexpr size_t computeSlotNumber(size_t bucket) {
+        return (BucketBegins::values[bucket+1]-BucketBegins::values[bucket])*(BucketBegins::values[bucket+1]-BucketBegins::values[bucket]);
+    }
+
+
+    /** @brief Returns the first seed that maps the names of a bucket onto distinct slots
+     * @param[in] bucket The bucket
+     * @return The bucket's seed, MAX_SEED if there is none
+     */
+    static constexpr unsigned int computeSeed(size_t bucket) {
+        return findSeed(BucketBegins::values[bucket], BucketBegins::values[bucket+1], computeSlotNumber(bucket), 0, MAX_SEED);
+    }
+
+
+    /** @brief Returns the name stored in a slot
+     * @param[in] slot The slot
+     * @return The begin of the name, 0 if the slot is empty
+     */
+    static constexpr const char *computeSlotName(size_t slot) {
+        return nameInSlot(slot)==NAME_NUMBER ? 0 : Names::names[nameInSlot(slot)];
+    }
+
+
+    /** @brief Returns the option the name stored in a slot belongs to
+     * @param[in] slot The slot
+     * @return The index of the option, OPTION_NUMBER if the slot is empty
+     */
+    static constexpr size_t computeSlotOption(size_t slot) {
+        return nameInSlot(slot)==NAME_NUMBER ? OPTION_NUMBER : Names::options[nameInSlot(slot)];
+    }
+
+
+    /** @brief Returns the hash of the name stored in a slot
+     * @param[in] slot The slot
+     * @return The name's hash, 0 if the slot is empty
+     */
+    static constexpr unsigned long long computeSlotHash(size_t slot) {
+        return nameInSlot(slot)==NAME_NUMBER ? 0 : Names::hashes[nameInSlot(slot)];
+    }
+    /// @}
+
+
+    /// @brief Using the Tables
+    /// @{
+
+    /** @brief Returns the bucket of a hash
+     * @param[in] hash The hash of a name
+     * @return The bucket the name would be stored in
+     */
+    static constexpr size_t bucketOf(unsigned long long hash) {
+        return (size_t) (hash % NAME_NUMBER);
+    }
+
+
+    /** @brief Returns the slot a hash is mapped onto within the given bucket
+     * @param[in] hash The hash of a name
+     * @param[in] bucket The bucket of the hash (not empty)
+     * @return The slot the name would be stored in
+     */
+    static constexpr size_t slotOf(unsigned long long hash, size_t bucket) {
+        return Offsets::values[bucket] + slotInBucket(hash, Buckets::seeds[bucket], Buckets::slots[bucket]);
+    }
+
+
+    /** @brief Returns whether all names have distinct hashes
+     * @return Whether no two names have the same hash
+     */
+    static constexpr bool isCollisionFree() {
+        return bucketsCollisionFree(0, NAME_NUMBER);
+    }
+
+
+    /** @brief Returns whether a seed was found for each bucket
+     * @return Whether the table is perfect
+     */
+    static constexpr bool isSeeded() {
+        return bucketsSeeded(0, NAME_NUMBER);
+    }
+    /// @}
+
+
+private:
+    /// @brief Returns the option of name k within the options [begin, end)
+    static constexpr size_t findOption(size_t k, size_t begin, size_t end) {
+        return end-begin==1 ? begin : (FirstNames::values[(begin+end)/2]<=k ? findOption(k, (begin+end)/2, end) : findOption(k, begin, (begin+end)/2));
+    }
+
+
+    /// @brief Returns the key names are sorted by (their bucket, then their index)
+    static constexpr size_t sortKey(size_t k) {
+        return bucketOf(Names::hashes[k])*NAME_NUMBER + k;
+    }
+
+
+    /// @brief Returns the name index at position j of the given level
+    template<size_t Level>
+    static constexpr size_t sortedAt(size_t j) {
+        return OptionsStaticSorted<OptionsStaticLayout, Level, NameIndices>::values[j];
+    }
+
+
+    /// @brief Returns the entry t of merging the two runs of the given width starting at begin
+    template<size_t Level>
+    static constexpr size_t mergeRuns(size_t begin, size_t t, size_t width) {
+        return mergeAt<Level>(begin, t, begin+width<NAME_NUMBER ? width : NAME_NUMBER-begin, begin+2*width<NAME_NUMBER ? width : (begin+width<NAME_NUMBER ? NAME_NUMBER-begin-width : 0));
+    }
+
+
+    /// @brief Returns the entry t of merging the runs [begin, begin+lengthA) and [begin+lengthA, begin+lengthA+lengthB)
+    template<size_t Level>
+    static constexpr size_t mergeAt(size_t begin, size_t t, size_t lengthA, size_t lengthB) {
+        return takeAt<Level>(begin, t, lengthA, lengthB, findSplit<Level>(begin, t, lengthA, t>lengthB ? t-lengthB : 0, t<lengthA ? t : lengthA));
+    }
+
+
+    /// @brief Returns the smallest i within [lo, hi] so that the first t merged entries hold the first i entries of the first run
+    template<size_t Level>
+    static constexpr size_t findSplit(size_t begin, size_t t, size_t lengthA, size_t lo, size_t hi) {
+        return lo==hi ? lo : (isSplit<Level>(begin, t, lengthA, (lo+hi)/2) ? findSplit<Level>(begin, t, lengthA, lo, (lo+hi)/2) : findSplit<Level>(begin, t, lengthA, (lo+hi)/2+1, hi));
+    }
+
+
+    /// @brief Returns whether no entry of the second run that is taken before entry t is larger than entry i of the first run
+    template<size_t Level>
+    static constexpr bool isSplit(size_t begin, size_t t, size_t lengthA, size_t i) {
+        return i==t || i==lengthA || sortKey(sortedAt<Level-1>(begin+lengthA+t-i-1))<sortKey(sortedAt<Level-1>(begin+i));
+    }
+
+
+    /// @brief Returns the entry t of the merged runs, given the number i of entries of the first run before it
+    template<size_t Level>
+    static constexpr size_t takeAt(size_t begin, size_t t, size_t lengthA, size_t lengthB, size_t i) {
+        return i<lengthA && (t-i==lengthB || sortKey(sortedAt<Level-1>(begin+i))<sortKey(sortedAt<Level-1>(begin+lengthA+t-i)))
+            ? sortedAt<Level-1>(begin+i) : sortedAt<Level-1>(begin+lengthA+t-i);
+    }
+
+
+    /// @brief Returns the bucket of the sorted name at position j
+    static constexpr size_t bucketAt(size_t j) {
+        return bucketOf(Names::hashes[Sorted::values[j]]);
+    }
+
+
+    /// @brief Returns the first position within [lo, hi) whose name's bucket is not before the given one, hi if there is none
+    static constexpr size_t findBucketBegin(size_t bucket, size_t lo, size_t hi) {
+        return lo==hi ? lo : (bucketAt((lo+hi)/2)<bucket ? findBucketBegin(bucket, (lo+hi)/2+1, hi) : findBucketBegin(bucket, lo, (lo+hi)/2));
+    }
+
+
+    /// @brief Returns the slot within its bucket of the given number of slots a hash is mapped onto using the given seed
+    static constexpr size_t slotInBucket(unsigned long long hash, unsigned int seed, size_t slots) {
+        return (size_t) (OptionsStaticNames::scramble(hash, seed) % slots);
+    }
+
+
+    /// @brief Returns whether the sorted name at a is mapped onto another slot than the ones within [b, end)
+    static constexpr bool isUnique(size_t a, size_t b, size_t end, unsigned int seed, size_t slots) {
+        return b==end || (slotInBucket(Names::hashes[Sorted::values[a]], seed, slots)!=slotInBucket(Names::hashes[Sorted::values[b]], seed, slots) && isUnique(a, b+1, end, seed, slots));
+    }
+
+
+    /// @brief Returns whether the sorted names within [begin, end) are mapped onto distinct slots
+    static constexpr bool isPerfect(size_t begin, size_t end, unsigned int seed, size_t slots) {
+        return begin==end || (isUnique(begin, begin+1, end, seed, slots) && isPerfect(begin+1, end, seed, slots));
+    }
+
+
+    /// @brief Returns the first seed within [lo, hi) that maps the sorted names within [begin, end) onto distinct slots, MAX_SEED if there is none
+    static constexpr unsigned int findSeed(size_t begin, size_t end, size_t slots, unsigned int lo, unsigned int hi) {
+        return hi-lo==1 ? (isPerfect(begin, end, lo, slots) ? lo : MAX_SEED) : orFindSeed(findSeed(begin, end, slots, lo, (lo+hi)/2), begin, end, slots, (lo+hi)/2, hi);
+    }
+
+
+    /// @brief Returns the found seed or searches the remaining range
+    static constexpr unsigned int orFindSeed(unsigned int found, size_t begin, size_t end, size_t slots, unsigned int lo, unsigned int hi) {
+        return found!=MAX_SEED ? found : findSeed(begin, end, slots, lo, hi);
+    }
+
+
+    /// @brief Returns the bucket holding a slot within the buckets [begin, end)
+    static constexpr size_t findBucket(size_t slot, size_t begin, size_t end) {
+        return end-begin==1 ? begin : (Offsets::values[(begin+end)/2]<=slot ? findBucket(slot, (begin+end)/2, end) : findBucket(slot, begin, (begin+end)/2));
+    }
+
+
+    /// @brief Returns the name among the sorted names within [j, end) of the given bucket that is stored in the given slot, NAME_NUMBER if there is none
+    static constexpr size_t findInSlot(size_t j, size_t end, size_t bucket, size_t slot) {
+        return j==end ? NAME_NUMBER : (slotOf(Names::hashes[Sorted::values[j]], bucket)==slot ? Sorted::values[j] : findInSlot(j+1, end, bucket, slot));
+    }
+
+
+    /// @brief Returns the name stored in a slot within the given bucket, NAME_NUMBER if the slot is empty
+    static constexpr size_t nameInSlot(size_t slot, size_t bucket) {
+        return findInSlot(BucketBegins::values[bucket], BucketBegins::values[bucket+1], bucket, slot);
+    }
+
+
+    /// @brief Returns the name stored in a slot, NAME_NUMBER if the slot is empty
+    static constexpr size_t nameInSlot(size_t slot) {
+        return nameInSlot(slot, findBucket(slot, 0, NAME_NUMBER));
+    }
+
+
+    /// @brief Returns whether the hash of the sorted name at a differs from the ones within [b, end)
+    static constexpr bool differsFrom(size_t a, size_t b, size_t end) {
+        return b==end || (Names::hashes[Sorted::values[a]]!=Names::hashes[Sorted::values[b]] && differsFrom(a, b+1, end));
+    }
+
+
+    /// @brief Returns whether the sorted names within [begin, end) have distinct hashes
+    static constexpr bool hasDistinctHashes(size_t begin, size_t end) {
+        return begin==end || (differsFrom(begin, begin+1, end) && hasDistinctHashes(begin+1, end));
+    }
+
+
+    /// @brief Returns whether the names of the buckets [begin, end) have distinct hashes
+    static constexpr bool bucketsCollisionFree(size_t begin, size_t end) {
+        return end-begin==1 ? hasDistinctHashes(BucketBegins::values[begin], BucketBegins::values[begin+1]) : bucketsCollisionFree(begin, (begin+end)/2) && bucketsCollisionFree((begin+end)/2, end);
+    }
+
+
+    /// @brief Returns whether a seed was found for the buckets [begin, end)
+    static constexpr bool bucketsSeeded(size_t begin, size_t end) {
+        return end-begin==1 ? Buckets::seeds[begin]!=MAX_SEED : bucketsSeeded(begin, (begin+end)/2) && bucketsSeeded((begin+end)/2, end);
+    }
+
+
+};
+
+
+/**
+ * @class OptionsStaticSchema
+ * @brief Options declared at compile time, stored as plain members
+ *
+ * The options are declared as types using OPTIONS_STATIC_OPTION and given
+ *  as the template's parameters:
+ * @code
+ * OPTIONS_STATIC_OPTION(Threads, int, "threads;j;jobs", 4);
+ * OPTIONS_STATIC_OPTION(Verbose, bool, "verbose;v", false);
+ * typedef OptionsStaticSchema<Threads, Verbose> AppOptions;
+ * AppOptions options;
+ * options.parse(argc, argv);
+ * int threads = options.get<OPTIONS_KEY("threads")>();
+ * @endcode
+ *
+ * Nothing is built at startup: the values are members (see
+ *  OptionsStaticValues), the
+ *  names are only kept as string literals. get resolves the name at
+ *  compile time; unknown names (and names of different options with the
+ *  same hash) fail to compile. For parsing, a perfect hash table over all
+ *  names and synonyms is computed at compile time (see OptionsStaticLayout);
+ *  a name is looked up by hashing it once and comparing it to the name
+ *  stored in its slot.
+ *
+ * The schema is meant for tools with a fixed set of options; it does not
+ *  support help screens or configuration files, use OptionsCont for these.
+ */
+template<class... Options>
+class OptionsStaticSchema {
+public:
+    /// @brief The compile-time computations over the options' names
+    typedef OptionsStaticLayout<Options...> Layout;
+
+    /// @brief The type of the values' storage
+    typedef OptionsStaticValues<typename OptionsMakeIndices<sizeof...(Options)>::type, Options...> Values;
+
+    /// @brief The number of options
+    static const size_t OPTION_NUMBER = sizeof...(Options);
+
+    /// @brief The type declaring the option at the given index
+    template<size_t Index> struct OptionAt {
+        typedef decltype(Values::template optionAt<Index>((const Values *) 0)) type;
+        typedef typename type::value_type value_type;
+    };
+
+    /// @brief The value type of the option with the given key (of the first option if the key is not known)
+    template<unsigned long long Key> struct ValueOf {
+        typedef typename OptionAt<OptionsStaticSchema::indexOf(Key)<OPTION_NUMBER ? OptionsStaticSchema::indexOf(Key) : 0>::value_type type;
+    };
+
+
+    /// @brief Constructor, sets the defaults
+    OptionsStaticSchema() {
+        for(size_t i=0; i<OPTION_NUMBER; ++i) {
+            myAmSet[i] = false;
+        }
+    }
+
+
+    /// @brief Retrieving Option Values
+    /// @{
+
+    /** @brief Returns the value of the option with the given key
+     * @tparam Key The key of the option's name (see OPTIONS_KEY)
+     * @return The option's value
+     */
+    template<unsigned long long Key>
+    const typename ValueOf<Key>::type &get() const {
+        static_assert(indexOf(Key)<OPTION_NUMBER, "The option is not known.");
+        return Values::template at<indexOf(Key)<OPTION_NUMBER ? indexOf(Key) : 0>(myValues).value;
+    }
+
+
+    /** @brief Returns whether the option with the given key was set (not only defaulted)
+     * @tparam Key The key of the option's name (see OPTIONS_KEY)
+     * @return Whether the option was set
+     */
+    template<unsigned long long Key>
+    bool isSet() const {
+        static_assert(indexOf(Key)<OPTION_NUMBER, "The option is not known.");
+        return myAmSet[indexOf(Key)];
+    }
+
+
+    /** @brief Returns the index of the named option
+     *
+     * Uses the perfect hash table built at compile time.
+     * @param[in] name The name (or synonym) of the option
+     * @return The option's index, OPTION_NUMBER if the option is not known
+     */
+    static size_t find(const char *name) {
+        const unsigned long long hash = OptionsStaticNames::hash(name);
+        const size_t bucket = Layout::bucketOf(hash);
+        if(Buckets::slots[bucket]==0) {
+            return OPTION_NUMBER;
+        }
+        const size_t slot = Layout::slotOf(hash, bucket);
+        if(Slots::hashes[slot]!=hash || Slots::names[slot]==0 || !OptionsStaticNames::equals(name, Slots::names[slot])) {
+            return OPTION_NUMBER;
+        }
+        return Slots::options[slot];
+    }
+
+
+    /** @brief Returns the index of the option with the given key
+     * @param[in] key The key of the name (see OPTIONS_KEY)
+     * @return The option's index, OPTION_NUMBER if no name has the key
+     */
+    static constexpr size_t indexOf(unsigned long long key) {
+        return Buckets::slots[Layout::bucketOf(key)]==0 ? OPTION_NUMBER : indexAt(key, Layout::slotOf(key, Layout::bucketOf(key)));
+    }
+    /// @}
+
+
+    /// @brief Setting Option Values
+    /// @{
+
+    /** @brief Sets the value of the option with the given key
+     * @tparam Key The key of the option's name (see OPTIONS_KEY)
+     * @param[in] value The value to set
+     */
+    template<unsigned long long Key>
+    void set(const typename ValueOf<Key>::type &value) {
+        static_assert(indexOf(Key)<OPTION_NUMBER, "The option is not known.");
+        Values::template at<indexOf(Key)<OPTION_NUMBER ? indexOf(Key) : 0>(myValues).value = value;
+        myAmSet[indexOf(Key)] = true;
+    }
+
+
+    /** @brief Sets the named option from the given string
+     * @param[in] name The name (or synonym) of the option
+     * @param[in] value The value to set
+     * @throw runtime_error If the option is not known or the value is not valid
+     */
+    void set(const std::string &name, const std::string &value) {
+        size_t index = find(name.c_str());
+        if(index==OPTION_NUMBER) {
+            throw std::runtime_error("Option '" + name + "' is not known.");
+        }
+        try {
+            Setters::setters[index](*this, value);
+        } catch(std::runtime_error &e) {
+            throw std::runtime_error("Could not set option '" + name + "'; reason: " + e.what());
+        }
+    }
+
+
+    /** @brief Parses the command line
+     *
+     * Options are given as "--NAME VALUE", "--NAME=VALUE", or, for names
+     *  consisting of a single character, as "-N VALUE" or "-N=VALUE". Bool
+     *  options are set to true if given without a value.
+     * @param[in] argc The number of arguments given on the command line
+     * @param[in] argv The arguments given on the command line
+     * @throw runtime_error If an option is not known, misses its value, or the value is not valid
+     */
+    void parse(int argc, char **argv) {
+        for(int i=1; i<argc; ++i) {
+            const char *arg = argv[i];
+            if(arg[0]!='-' || arg[1]==0 || (arg[1]=='-' && arg[2]==0)) {
+                throw std::runtime_error(std::string("Unrecognized option '") + arg + "'.");
+            }
+            std::string name = arg[1]=='-' ? arg+2 : arg+1;
+            std::string value;
+            bool hasValue = false;
+            size_t idx = name.find('=');
+            if(idx!=std::string::npos) {
+                value = name.substr(idx+1);
+                name = name.substr(0, idx);
+                hasValue = true;
+            }
+            size_t index = find(name.c_str());
+            if(index==OPTION_NUMBER || (arg[1]!='-' && name.length()!=1)) {
+                throw std::runtime_error(std::string("Unrecognized option '") + arg + "'.");
+            }
+            if(!hasValue) {
+                if(Setters::isBool[index]) {
+                    value = "true";
+                } else if(i+1<argc) {
+                    value = argv[++i];
+                } else {
+                    throw std::runtime_error("Option '" + name + "' needs a value.");
+                }
+            }
+            set(name, value);
+        }
+    }
+    /// @}
+
+
+    /** @brief Sets the option at the given index from a string (used by the parsing tables)
+     * @param[in] into The schema to set the value in
+     * @param[in] value The value to set
+     * @throw runtime_error If the value is not valid
+     */
+    template<size_t Index>
+    static void setFromString(OptionsStaticSchema &into, const std::string &value) {
+        parseValue(value, Values::template at<Index>(into.myValues).value);
+        into.myAmSet[Index] = true;
+    }
+
+
+private:
+    /// @brief Parses an integer value
+    static void parseValue(const std::string &value, int &into) {
+        into = Option_Integer::parseInteger(value.c_str());
+    }
+
+
+    /// @brief Parses a double value
+    static void parseValue(const std::string &value, double &into) {
+        into = Option_Double::parseDouble(value.c_str());
+    }
+
+
+    /// @brief Parses a bool value
+    static void parseValue(const std::string &value, bool &into) {
+        into = Option_Bool::parseBool(value);
+    }
+
+
+    /// @brief Sets a string value
+    static void parseValue(const std::string &value, std::string &into) {
+        into = value;
+    }
+
+
+    /// @brief Returns the index of the option whose name is stored in the slot if the name has the given key
+    static constexpr size_t indexAt(unsigned long long key, size_t slot) {
+        return Slots::names[slot]==0 || Slots::hashes[slot]!=key ? OPTION_NUMBER : Slots::options[slot];
+    }
+
+
+private:
+    static_assert(Layout::isCollisionFree(), "Two names of the options have the same hash.");
+
+    static_assert(Layout::isSeeded(), "The names of the options could not be hashed perfectly.");
+
+    /// @brief The buckets of the perfect hash table
+    typedef typename Layout::Buckets Buckets;
+
+    /// @brief The perfect hash table
+    typedef OptionsStaticSlots<Layout, typename OptionsMakeIndices<Layout::Offsets::values[Layout::NAME_NUMBER]>::type> Slots;
+
+    /// @brief The tables used when parsing
+    typedef OptionsStaticSetters<OptionsStaticSchema, typename OptionsMakeIndices<sizeof...(Options)>::type> Setters;
+
+
+    /// @brief The options' values
+    Values myValues;
+
+    /// @brief Whether the options were set
+    bool myAmSet[sizeof...(Options)];
+
+
+};
+
+
+// *************************************************************************
+#endif
@@ -0,0 +1,138 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsTransaction.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <utility>
+#include <memory>
+#include <stdexcept>
+#include "Option.h"
+#include "OptionsBatchScope.h"
+#include "OptionsCont.h"
+#include "OptionsTransaction.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+OptionsTransaction::OptionsTransaction(OptionsCont &options)
+    : myOptions(options) {
+}
+
+
+OptionsTransaction::~OptionsTransaction() {
+}
+
+
+void
+OptionsTransaction::set(const std::string &name, const std::string &value) {
+    myValues.push_back(std::make_pair(name, value));
+}
+
+
+size_t
+OptionsTransaction::size() const {
+    return myValues.size();
+}
+
+
+void
+OptionsTransaction::clear() {
+    myValues.clear();
+}
+
+
+void
+OptionsTransaction::commit() {
+    // resolve the names; the last value staged for an option wins
+    const size_t unused = (size_t) -1;
+    std::vector<size_t> slots(myOptions.getOptionNumber(), unused);
+    std::vector<std::pair<Option*, const std::string*> > updates;
+    updates.reserve(myValues.size());
+    for(std::vector<std::pair<std::string, std::string> >::const_iterator i=myValues.begin(); i!=myValues.end(); ++i) {
+        const std::string &name = (*i).first;
+        Option *option = myOptions.getOptionSecure(name);
+        if(option==0) {
+            throw std::runtime_error("Could not set option '" + name + "'; reason: Option '" + name + "' is not known.");
+        }
+        size_t id = myOptions.myOption2Index.find(option)->second;
+        if(slots[id]==unused) {
+            slots[id] = updates.size();
+            updates.push_back(std::make_pair(option, &(*i).second));
+        } else {
+            updates[slots[id]].second = &(*i).second;
+        }
+    }
+    // check all values first (see Option::validate); nothing is copied or
+    //  changed if one of them is not valid
+    for(std::vector<std::pair<Option*, const std::string*> >::const_iterator i=updates.begin(); i!=updates.end(); ++i) {
+        try {
+            if(!(*i).first->canBeSet()) {
+                throw std::runtime_error("This option was already set.");
+            }
+            (*i).first->validate(*(*i).second);
+        } catch(std::runtime_error &e) {
+            throw std::runtime_error("Could not set option '" + myOptions.getOptionNameAt(myOptions.myOption2Index.find((*i).first)->second) + "'; reason: " + e.what());
+        }
+    }
+    // set the options; the state of each option is kept before it is changed,
+    //  so that the options changed so far can be restored if setting one fails
+    //  nevertheless (e.g. an option type that does not validate values)
+    std::vector<std::pair<size_t, std::shared_ptr<const Option> > > changed;
+    changed.reserve(updates.size());
+    for(std::vector<std::pair<Option*, const std::string*> >::const_iterator i=updates.begin(); i!=updates.end(); ++i) {
+        size_t id = myOptions.myOption2Index.find((*i).first)->second;
+        changed.push_back(std::make_pair(id, std::shared_ptr<const Option>((*i).first->clone())));
+        try {
+            (*i).first->set(*(*i).second);
+        } catch(std::runtime_error &e) {
+            for(std::vector<std::pair<size_t, std::shared_ptr<const Option> > >::const_reverse_iterator j=changed.rbegin(); j!=changed.rend(); ++j) {
+                myOptions.myOptions[(*j).first]->restore(*(*j).second);
+            }
+            throw std::runtime_error("Could not set option '" + myOptions.getOptionNameAt(id) + "'; reason: " + e.what());
+        }
+    }
+    // inform the subscribers once all values are set
+    OptionsBatchScope batch(myOptions);
+    for(std::vector<std::pair<size_t, std::shared_ptr<const Option> > >::const_iterator i=changed.begin(); i!=changed.end(); ++i) {
+        myOptions.noteChangeSince((*i).first, *(*i).second);
+    }
+    myValues.clear();
+}
+
+
+// *************************************************************************
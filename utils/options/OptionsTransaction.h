@@ -0,0 +1,120 @@
+#ifndef OptionsTransaction_h
+#define OptionsTransaction_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsTransaction.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <utility>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class OptionsCont;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsTransaction
+ * @brief Sets many options at once or none of them
+ *
+ * Values are staged using set() and applied by commit(). Committing
+ *  resolves all names and checks all values (see Option::validate) before
+ *  setting any; if a check fails, no option is changed. If setting an
+ *  option fails nevertheless, the options set before are restored (see
+ *  Option::restore) to copies taken before they were changed.
+ *
+ * If an option is staged more than once, the last value is used.
+ *  Subscribers (see OptionsCont::subscribe) are informed about all
+ *  changes of a commit in one batch.
+ */
+class OptionsTransaction {
+public:
+    /** @brief Constructor
+     * @param[in] options The options container to change
+     */
+    OptionsTransaction(OptionsCont &options);
+
+
+    /// @brief Destructor, staged values that were not committed are discarded
+    ~OptionsTransaction();
+
+
+    /** @brief Stages a value
+     * @param[in] name The name of the option to set
+     * @param[in] value The value to set
+     */
+    void set(const std::string &name, const std::string &value);
+
+
+    /** @brief Returns the number of staged values
+     * @return The number of staged values
+     */
+    size_t size() const;
+
+
+    /// @brief Discards the staged values
+    void clear();
+
+
+    /** @brief Sets all staged values
+     *
+     * The staged values are discarded if they were set; they are kept if
+     *  the transaction failed.
+     * @throw runtime_error If an option is not known, cannot be set, or a value is invalid; no option is changed then
+     */
+    void commit();
+
+
+private:
+    /// @brief The options container to change
+    OptionsCont &myOptions;
+
+    /// @brief The staged names and values
+    std::vector<std::pair<std::string, std::string> > myValues;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsTransaction(const OptionsTransaction &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsTransaction &operator=(const OptionsTransaction &s);
+
+
+};
+
+
+// *************************************************************************
+#endif
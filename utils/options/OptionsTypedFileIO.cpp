@@ -20,11 +20,25 @@
 /* =========================================================================
  * included modules
  * ======================================================================= */
+#include "Option.h"
 #include "OptionsCont.h"
+#include "OptionsHash.h"
+#include "OptionsConfigurationCache.h"
+#include "OptionsParsedConfiguration.h"
 #include "OptionsTypedFileIO.h"
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <set>
+#include <map>
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <future>
+#include <functional>
+#include <typeinfo>
+#include <stdexcept>
 
 /* -------------------------------------------------------------------------
  * (optional) memory checking
@@ -42,10 +56,130 @@ using namespace std;
 
 
 
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsParentPrefetcher
+ * @brief Reads the files of a hierarchical configuration in the background
+ *
+ * Each file is parsed on an own thread. As soon as the entry that names
+ *  the parent is parsed, reading the parent is started, so that the files
+ *  of a chain are read in a pipeline. Each file is read only once.
+ */
+class OptionsParentPrefetcher {
+public:
+    /// @brief Definition of a pointer to a parsed configuration
+    typedef std::shared_ptr<const OptionsParsedConfiguration> ParsedPtr;
+
+
+    /** @brief Constructor
+     * @param[in] reader The reader to use for parsing
+     * @param[in] parentNames The names (synonyms) of the option that names the parent
+     */
+    OptionsParentPrefetcher(OptionsTypedFileIO &reader, const std::vector<std::string> &parentNames)
+        : myReader(reader), myParentNames(parentNames) {
+    }
+
+
+    /// @brief Destructor, waits for all started reads
+    ~OptionsParentPrefetcher() {
+        // reads may start further reads, so loop until all are known to be finished
+        size_t waited = 0;
+        while(true) {
+            std::vector<std::shared_future<ParsedPtr> > pending;
+            {
+                std::lock_guard<std::mutex> lock(myLock);
+                if(myFiles.size()==waited) {
+                    return;
+                }
+                for(std::map<std::string, std::shared_future<ParsedPtr> >::iterator i=myFiles.begin(); i!=myFiles.end(); ++i) {
+                    pending.push_back((*i).second);
+                }
+                waited = myFiles.size();
+            }
+            for(std::vector<std::shared_future<ParsedPtr> >::iterator i=pending.begin(); i!=pending.end(); ++i) {
+                (*i).wait();
+            }
+        }
+    }
+
+
+    /** @brief Starts reading the named file if this was not yet done
+     * @param[in] fileName The name of the file to read
+     */
+    void request(const std::string &fileName) {
+        std::lock_guard<std::mutex> lock(myLock);
+        if(myFiles.find(fileName)==myFiles.end()) {
+            myFiles[fileName] = std::async(std::launch::async, &OptionsParentPrefetcher::parse, this, fileName).share();
+        }
+    }
+
+
+    /** @brief Returns the parsed configuration of the named file, waiting for it if needed
+     * @param[in] fileName The name of the file to read
+     * @return The parsed configuration, an empty pointer if the file could not be parsed
+     */
+    ParsedPtr get(const std::string &fileName) {
+        request(fileName);
+        std::shared_future<ParsedPtr> f;
+        {
+            std::lock_guard<std::mutex> lock(myLock);
+            f = myFiles[fileName];
+        }
+        return f.get();
+    }
+
+
+private:
+    /** @brief Parses the named file, requesting its parent as soon as it is known
+     * @param[in] fileName The name of the file to read
+     * @return The parsed configuration, an empty pointer if the file could not be parsed
+     */
+    ParsedPtr parse(std::string fileName) {
+        return myReader.getParsedConfiguration(fileName, myParentNames,
+            std::bind(&OptionsParentPrefetcher::request, this, std::placeholders::_1));
+    }
+
+
+private:
+    /// @brief The reader to use
+    OptionsTypedFileIO &myReader;
+
+    /// @brief The names of the option that names the parent
+    std::vector<std::string> myParentNames;
+
+    /// @brief A lock for myFiles
+    std::mutex myLock;
+
+    /// @brief The started reads
+    std::map<std::string, std::shared_future<ParsedPtr> > myFiles;
+
+
+private:
+    /// @brief Invalidated copy constructor
+    OptionsParentPrefetcher(const OptionsParentPrefetcher &s);
+
+    /// @brief Invalidated assignment operator
+    OptionsParentPrefetcher &operator=(const OptionsParentPrefetcher &s);
+
+
+};
+
+
+
+/* =========================================================================
+ * static member definitions
+ * ======================================================================= */
+bool OptionsTypedFileIO::myUseCache = true;
+
+
+
 /* =========================================================================
  * method definitions
  * ======================================================================= */
-OptionsTypedFileIO::OptionsTypedFileIO() {
+OptionsTypedFileIO::OptionsTypedFileIO()
+    : myPrefetchParents(false) {
 }
 
 
@@ -57,20 +191,239 @@ bool
 OptionsTypedFileIO::loadConfiguration(OptionsCont &into, const std::string &configOptionName) {
     const std::string &parentName = into.getParentConfigurationName();
     std::string fileName = into.getString(configOptionName);
+    std::set<std::string> loaded;
+    myLoadedFiles.clear();
+    myAppliedOptions.clear();
+    // the state of the options the files set is remembered before setting
+    //  them (see OptionsParsedConfiguration::apply); options removed from
+    //  the files are reset to it when reloading
+    myPreviousOptions.clear();
+    std::unique_ptr<OptionsParentPrefetcher> prefetcher;
+    if(myPrefetchParents && parentName!="") {
+        prefetcher.reset(new OptionsParentPrefetcher(*this, into.getSynonyms(parentName)));
+    }
     bool ok = true;
     do {
+        loaded.insert(fileName);
+        myLoadedFiles.push_back(fileName);
         if(parentName!="") {
             into.remarkUnset(parentName);
         }
-        ok &= _loadConfiguration(into, fileName);
+        if(prefetcher) {
+            std::shared_ptr<const OptionsParsedConfiguration> parsed = prefetcher->get(fileName);
+            ok &= parsed && parsed->apply(into, fileName, &myAppliedOptions, &myPreviousOptions);
+        } else {
+            ok &= _loadConfiguration(into, fileName);
+        }
         fileName = "";
-        if(parentName!="" && !into.isDefault(parentName)) {
+        // follow the parent only if the file just loaded has named one
+        if(ok && parentName!="" && !into.canBeSet(parentName)) {
             fileName = into.getString(parentName);
+            if(loaded.find(fileName)!=loaded.end()) {
+                std::cerr << std::endl << "Error: The parent configuration '" << fileName << "' was already loaded (cyclic hierarchy)." << std::endl;
+                ok = false;
+            }
         }
     } while (ok && fileName!="");
+    // remember the hashes of the values set from the files for reloading
+    myFileOptionHashes.clear();
+    for(std::vector<std::pair<std::string, unsigned long long> >::const_iterator i=myAppliedOptions.begin(); i!=myAppliedOptions.end(); ++i) {
+        myFileOptionHashes[into.getOptionID((*i).first)] = (*i).second;
+    }
+    myFileOptionDefaults.swap(myPreviousOptions);
+    myPreviousOptions.clear();
+    myAppliedOptions.clear();
     return ok;
 }
 
 
+bool
+OptionsTypedFileIO::reloadConfiguration(OptionsCont &into, const std::string &configOptionName, std::vector<size_t> &changed, bool tunablesOnly) {
+    // resolve the values the files give now, child first; nothing is touched yet
+    const std::string &parentName = into.getParentConfigurationName();
+    std::vector<std::string> parentNames;
+    size_t parentID = 0;
+    if(parentName!="") {
+        parentNames = into.getSynonyms(parentName);
+        parentID = into.getOptionID(parentName);
+    }
+    std::map<size_t, std::string> values;
+    std::vector<std::string> files;
+    std::set<std::string> loaded;
+    std::string fileName = into.getString(configOptionName);
+    std::string parent;
+    while(fileName!="") {
+        if(!loaded.insert(fileName).second) {
+            std::cerr << std::endl << "Error: The parent configuration '" << fileName << "' was already loaded (cyclic hierarchy)." << std::endl;
+            return false;
+        }
+        files.push_back(fileName);
+        std::shared_ptr<const OptionsParsedConfiguration> parsed = getParsedConfiguration(fileName);
+        // each file names its own parent; the option keeps the last one named
+        if(parentName!="") {
+            values.erase(parentID);
+        }
+        if(!parsed || !parsed->resolve(into, fileName, values)) {
+            return false;
+        }
+        fileName = "";
+        if(parentName!="" && values.find(parentID)!=values.end()) {
+            parent = values[parentID];
+            fileName = parent;
+        }
+    }
+    if(parent!="") {
+        values[parentID] = parent;
+    }
+    // collect the options whose values differ from the ones set before
+    //  and the ones that were removed from the files (reset to their defaults)
+    std::vector<std::pair<size_t, const std::string*> > updates;
+    for(std::map<size_t, std::string>::const_iterator i=values.begin(); i!=values.end(); ++i) {
+        size_t id = (*i).first;
+        std::map<size_t, unsigned long long>::const_iterator j = myFileOptionHashes.find(id);
+        if(j==myFileOptionHashes.end() && !into.getOptionAt(id).canBeSet()) {
+            // set on the command line or from the environment
+            continue;
+        }
+        if(j!=myFileOptionHashes.end() && (*j).second==OptionsHash::fnv1a((*i).second)) {
+            continue;
+        }
+        updates.push_back(std::make_pair(id, &(*i).second));
+    }
+    for(std::map<size_t, unsigned long long>::const_iterator i=myFileOptionHashes.begin(); i!=myFileOptionHashes.end(); ++i) {
+        if(values.find((*i).first)==values.end() && myFileOptionDefaults.find((*i).first)!=myFileOptionDefaults.end()) {
+            updates.push_back(std::make_pair((*i).first, (const std::string*) 0));
+        }
+    }
+    // check all values before any is set
+    for(std::vector<std::pair<size_t, const std::string*> >::const_iterator i=updates.begin(); i!=updates.end(); ++i) {
+        const Option &option = into.getOptionAt((*i).first);
+        const std::string &name = into.getOptionNameAt((*i).first);
+        try {
+            if(tunablesOnly && !option.isTunable()) {
+                throw std::runtime_error("Option '" + name + "' is not tunable.");
+            }
+            if((*i).second!=0) {
+                option.validate(*(*i).second);
+            }
+        } catch(std::runtime_error &ex) {
+            throw std::runtime_error("Could not set option '" + name + "' while reloading; reason: " + ex.what());
+        }
+    }
+    // set them; if setting fails nevertheless, the options set so far are restored
+    std::vector<std::pair<size_t, std::shared_ptr<const Option> > > previous;
+    std::vector<size_t> changedNow;
+    for(std::vector<std::pair<size_t, const std::string*> >::const_iterator i=updates.begin(); i!=updates.end(); ++i) {
+        size_t id = (*i).first;
+        const Option &option = into.getOptionAt(id);
+        previous.push_back(std::make_pair(id, std::shared_ptr<const Option>(option.clone())));
+        bool wasSet = option.isSet();
+        std::string before = wasSet ? option.getValueAsString() : "";
+        const std::string &name = into.getOptionNameAt(id);
+        try {
+            if((*i).second==0) {
+                into.restore(id, *myFileOptionDefaults[id]);
+            } else if(tunablesOnly) {
+                into.tune(name, *(*i).second);
+            } else {
+                into.remarkUnset(name);
+                into.set(name, *(*i).second);
+            }
+        } catch(std::runtime_error &ex) {
+            for(std::vector<std::pair<size_t, std::shared_ptr<const Option> > >::reverse_iterator j=previous.rbegin(); j!=previous.rend(); ++j) {
+                into.restore((*j).first, *(*j).second);
+            }
+            throw std::runtime_error("Could not set option '" + name + "' while reloading; reason: " + ex.what());
+        }
+        if(wasSet!=option.isSet() || (wasSet && before!=option.getValueAsString())) {
+            changedNow.push_back(id);
+        }
+    }
+    for(std::vector<std::pair<size_t, const std::string*> >::const_iterator i=updates.begin(); i!=updates.end(); ++i) {
+        if((*i).second==0) {
+            myFileOptionHashes.erase((*i).first);
+            myFileOptionDefaults.erase((*i).first);
+        } else {
+            myFileOptionHashes[(*i).first] = OptionsHash::fnv1a(*(*i).second);
+        }
+    }
+    std::sort(changedNow.begin(), changedNow.end());
+    changed.insert(changed.end(), changedNow.begin(), changedNow.end());
+    myLoadedFiles = files;
+    return true;
+}
+
+
+const std::vector<std::string> &
+OptionsTypedFileIO::getLoadedFiles() const {
+    return myLoadedFiles;
+}
+
+
+void
+OptionsTypedFileIO::setUseCache(bool value) {
+    myUseCache = value;
+}
+
+
+bool
+OptionsTypedFileIO::getUseCache() {
+    return myUseCache;
+}
+
+
+void
+OptionsTypedFileIO::setPrefetchParents(bool value) {
+    myPrefetchParents = value;
+}
+
+
+bool
+OptionsTypedFileIO::_loadConfiguration(OptionsCont &into, const std::string &configurationName) {
+    std::shared_ptr<const OptionsParsedConfiguration> parsed = getParsedConfiguration(configurationName);
+    if(!parsed) {
+        return false;
+    }
+    return parsed->apply(into, configurationName, &myAppliedOptions, &myPreviousOptions);
+}
+
+
+std::shared_ptr<const OptionsParsedConfiguration>
+OptionsTypedFileIO::getParsedConfiguration(const std::string &configurationName) {
+    return getParsedConfiguration(configurationName, std::vector<std::string>(), nullptr);
+}
+
+
+std::shared_ptr<const OptionsParsedConfiguration>
+OptionsTypedFileIO::getParsedConfiguration(const std::string &configurationName,
+                                           const std::vector<std::string> &parentNames, std::function<void(const std::string &)> onParent) {
+    OptionsConfigurationCache::FileKey key;
+    bool cacheable = myUseCache && OptionsConfigurationCache::getFileKey(configurationName, key);
+    const char *reader = typeid(*this).name();
+    if(cacheable) {
+        std::shared_ptr<const OptionsParsedConfiguration> cached = OptionsConfigurationCache::get(key, reader);
+        if(cached) {
+            std::string parent;
+            if(onParent && cached->getValue(parentNames, parent)) {
+                onParent(parent);
+            }
+            return cached;
+        }
+    }
+    std::shared_ptr<OptionsParsedConfiguration> parsed = std::make_shared<OptionsParsedConfiguration>();
+    if(onParent) {
+        parsed->setEntryListener(parentNames, onParent);
+    }
+    bool ok = _parseConfiguration(configurationName, *parsed);
+    parsed->removeEntryListener();
+    if(!ok) {
+        return std::shared_ptr<const OptionsParsedConfiguration>();
+    }
+    if(cacheable) {
+        OptionsConfigurationCache::put(key, reader, parsed);
+    }
+    return parsed;
+}
+
 
 // *************************************************************************
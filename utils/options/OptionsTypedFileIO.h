@@ -21,6 +21,13 @@
 /* =========================================================================
  * included modules
  * ======================================================================= */
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include <memory>
+#include <functional>
+
 /* -------------------------------------------------------------------
  * (optional) memory checking
  * ----------------------------------------------------------------- */
@@ -32,7 +39,10 @@
 /* =========================================================================
  * class declarations
  * ======================================================================= */
+class Option;
 class OptionsCont;
+class OptionsParsedConfiguration;
+class OptionsParentPrefetcher;
 
 
 /* =========================================================================
@@ -41,6 +51,19 @@ class OptionsCont;
 /**
  * @class OptionsTypedFileIO
  * @brief A base class for loading/saving options from/to files
+ *
+ * Reading a configuration is split into parsing the file into an
+ *  OptionsParsedConfiguration (_parseConfiguration) and applying it to the
+ *  options container. Parsed configurations are kept in the process-wide
+ *  OptionsConfigurationCache, so that files shared by several containers
+ *  (e.g. the parents of hierarchical configurations) are read and parsed
+ *  only once as long as they do not change.
+ *
+ * If parents shall be prefetched (see setPrefetchParents), the files of a
+ *  hierarchical configuration are read in a pipeline: as soon as the entry
+ *  naming the parent has been parsed, the parent is read and parsed on a
+ *  background thread while the current file is still being processed. The
+ *  values are nevertheless applied strictly in the chain's order.
  */
 class OptionsTypedFileIO {
 public:
@@ -55,7 +78,8 @@ public:
     /** @brief Loads options from a configuration file
      * 
      * This method calls the protected member  _loadConfiguration(OptionsCont, String)
-     * within a loop that realises hierarchical configurations.
+     * within a loop that realises hierarchical configurations. The loop ends
+     * if a file does not name a parent or names one that was already loaded.
      * 
      * @see _loadConfiguration(OptionsCont, String)
      * @param[in] into The options container to fill
@@ -65,6 +89,36 @@ public:
     virtual bool loadConfiguration(OptionsCont &into, const std::string &configOptionName);
 
 
+    /** @brief Loads the configuration loaded by the last call to loadConfiguration again, incrementally
+     *
+     * The files are parsed (using the cache) and the values they give are
+     *  resolved without setting them. The hash of each value is compared
+     *  against the hash of the value that was set from the files before; only
+     *  options whose values differ are set again. Options given on the command
+     *  line or in the environment are not touched. Options that were removed
+     *  from the files are reset to the state they had before the files were
+     *  loaded. All values are checked before any is set; if a file cannot be
+     *  parsed or a value is invalid, no option is changed.
+     *
+     * If only tunable options may change, the values are changed using
+     *  OptionsCont::tune, so that the reload may run while other threads read
+     *  the options; a reload that would change other options fails then.
+     * @param[in] into The options container to fill
+     * @param[in] configOptionName The name of the option to get the path to the configuration to load from
+     * @param[out] changed The IDs of the options whose values have changed, including reset ones (sorted)
+     * @param[in] tunablesOnly Whether only tunable options may be changed
+     * @return Whether options could be loaded
+     * @throw runtime_error If a value is invalid or an option that shall change is not tunable (if only tunable options may change)
+     */
+    bool reloadConfiguration(OptionsCont &into, const std::string &configOptionName, std::vector<size_t> &changed, bool tunablesOnly=false);
+
+
+    /** @brief Returns the files read by the last call to loadConfiguration
+     * @return The loaded files, child first
+     */
+    const std::vector<std::string> &getLoadedFiles() const;
+
+
     /** @brief Writes the set options as an XML configuration file
      * @param[in] configName The name of the file to write the configuration to
      * @param[in] options The options container that includes the (set/parsed) options to write 
@@ -80,13 +134,90 @@ public:
     virtual bool writeXMLTemplate(const std::string &configName, const OptionsCont &options) = 0;
 
 
+    /** @brief Sets whether parsed configurations shall be cached
+     *
+     * Caching is enabled per default; it is a process-wide setting.
+     * @param[in] value Whether parsed configurations shall be cached
+     */
+    static void setUseCache(bool value);
+
+
+    /** @brief Returns whether parsed configurations are cached
+     * @return Whether parsed configurations are cached
+     */
+    static bool getUseCache();
+
+
+    /** @brief Sets whether the parents of hierarchical configurations shall be prefetched
+     *
+     * Prefetching is disabled per default. The reader's _parseConfiguration
+     *  method must be reentrant if it is enabled. Errors found in prefetched
+     *  files are reported even if loading stops before reaching them.
+     * @param[in] value Whether parent configurations shall be read in the background
+     */
+    void setPrefetchParents(bool value);
+
+
 protected:
     /** @brief Loads options from a configuration file
+     *
+     * The default implementation applies the (possibly cached) parsed configuration.
      * @param[in] into The options container to fill
      * @param[in] configurationName The path to the configuration to load
      * @return Whether options could be loaded
      */
-    virtual bool _loadConfiguration(OptionsCont &into, const std::string &configurationName) = 0;
+    virtual bool _loadConfiguration(OptionsCont &into, const std::string &configurationName);
+
+
+    /** @brief Parses a configuration file
+     * @param[in] configurationName The path to the configuration to parse
+     * @param[out] into The parsed configuration to fill
+     * @return Whether the file could be parsed
+     */
+    virtual bool _parseConfiguration(const std::string &configurationName, OptionsParsedConfiguration &into) = 0;
+
+
+    /** @brief Returns the parsed configuration, using the cache if enabled
+     * @param[in] configurationName The path to the configuration to parse
+     * @return The parsed configuration, an empty pointer if the file could not be parsed
+     */
+    std::shared_ptr<const OptionsParsedConfiguration> getParsedConfiguration(const std::string &configurationName);
+
+
+    /** @brief Returns the parsed configuration, reporting the parent's name as soon as it is known
+     * @param[in] configurationName The path to the configuration to parse
+     * @param[in] parentNames The names (synonyms) of the option that names the parent
+     * @param[in] onParent The method to call with the parent's name (called at most once)
+     * @return The parsed configuration, an empty pointer if the file could not be parsed
+     */
+    std::shared_ptr<const OptionsParsedConfiguration> getParsedConfiguration(const std::string &configurationName,
+        const std::vector<std::string> &parentNames, std::function<void(const std::string &)> onParent);
+
+
+private:
+    /// @brief Whether parsed configurations are cached
+    static bool myUseCache;
+
+    /// @brief Whether parent configurations are read in the background
+    bool myPrefetchParents;
+
+    /// @brief The files read by the last load
+    std::vector<std::string> myLoadedFiles;
+
+    /// @brief The names of the options set while loading and the hashes of their values
+    std::vector<std::pair<std::string, unsigned long long> > myAppliedOptions;
+
+    /// @brief The states of the options set while loading before they were set, by option ID
+    std::map<size_t, std::shared_ptr<const Option> > myPreviousOptions;
+
+    /// @brief The hashes of the values set from the files by option ID
+    std::map<size_t, unsigned long long> myFileOptionHashes;
+
+    /// @brief The states of the options set from the files before they were loaded, by option ID
+    std::map<size_t, std::shared_ptr<const Option> > myFileOptionDefaults;
+
+
+    friend class OptionsParentPrefetcher;
 
 
 };
@@ -0,0 +1,410 @@
+/** ************************************************************************
+   @project      options library
+   @file         OptionsWireFormat.cpp
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <cstring>
+#include <climits>
+#include <stdexcept>
+#include "Option.h"
+#include "OptionsBatchScope.h"
+#include "OptionsCont.h"
+#include "OptionsWireFormat.h"
+
+/* -------------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * used namespaces
+ * ======================================================================= */
+using namespace std;
+
+
+
+/* =========================================================================
+ * definitions
+ * ======================================================================= */
+/// @brief The types of encoded values
+enum WireValueType {
+    WIRE_INTEGER,
+    WIRE_DOUBLE,
+    WIRE_BOOL,
+    WIRE_STRING,
+    WIRE_TEXT
+};
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class WireWriter
+ * @brief Writes into a bounded buffer, counting what does not fit
+ */
+class WireWriter {
+public:
+    /** @brief Constructor
+     * @param[in] buffer The buffer to write into
+     * @param[in] capacity The size of the buffer
+     */
+    WireWriter(char *buffer, size_t capacity) : myBuffer(buffer), myCapacity(capacity), mySize(0) { }
+
+
+    /** @brief Writes the given bytes
+     * @param[in] data The bytes to write
+     * @param[in] length The number of bytes
+     */
+    void write(const char *data, size_t length) {
+        if(mySize+length<=myCapacity) {
+            memcpy(myBuffer+mySize, data, length);
+        }
+        mySize += length;
+    }
+
+
+    /** @brief Writes a byte
+     * @param[in] c The byte to write
+     */
+    void write(unsigned char c) {
+        if(mySize<myCapacity) {
+            myBuffer[mySize] = (char) c;
+        }
+        ++mySize;
+    }
+
+
+    /** @brief Writes a variable-length integer (7 bits per byte, lowest first)
+     * @param[in] value The value to write
+     */
+    void writeVarint(unsigned long long value) {
+        while(value>=0x80) {
+            write((unsigned char) (value | 0x80));
+            value >>= 7;
+        }
+        write((unsigned char) value);
+    }
+
+
+    /** @brief Writes 8 bytes, lowest first
+     * @param[in] value The value to write
+     */
+    void writeFixed(unsigned long long value) {
+        for(int i=0; i<8; ++i) {
+            write((unsigned char) (value >> (8*i)));
+        }
+    }
+
+
+    /** @brief Returns the number of bytes written (or needed)
+     * @return The size of the encoding
+     */
+    size_t getSize() const {
+        return mySize;
+    }
+
+
+private:
+    /// @brief The buffer
+    char *myBuffer;
+
+    /// @brief The size of the buffer
+    size_t myCapacity;
+
+    /// @brief The number of bytes written (or needed)
+    size_t mySize;
+
+
+};
+
+
+/**
+ * @class WireReader
+ * @brief Reads from a buffer, throwing if it ends too early
+ */
+class WireReader {
+public:
+    /** @brief Constructor
+     * @param[in] buffer The buffer to read from
+     * @param[in] length The length of the buffer
+     */
+    WireReader(const char *buffer, size_t length) : myBuffer(buffer), myLength(length), myPosition(0) { }
+
+
+    /** @brief Returns the next bytes and skips them
+     * @param[in] length The number of bytes
+     * @return The bytes
+     */
+    const char *read(size_t length) {
+        if(length>myLength-myPosition) {
+            throw std::runtime_error("The encoded options are truncated.");
+        }
+        const char *ret = myBuffer + myPosition;
+        myPosition += length;
+        return ret;
+    }
+
+
+    /** @brief Reads a variable-length integer
+     * @return The value read
+     */
+    unsigned long long readVarint() {
+        unsigned long long value = 0;
+        for(int shift=0; shift<64; shift+=7) {
+            unsigned char c = (unsigned char) *read(1);
+            value |= (unsigned long long) (c&0x7f) << shift;
+            if((c&0x80)==0) {
+                return value;
+            }
+        }
+        throw std::runtime_error("The encoded options are invalid.");
+    }
+
+
+    /** @brief Reads 8 bytes, lowest first
+     * @return The value read
+     */
+    unsigned long long readFixed() {
+        const unsigned char *data = (const unsigned char*) read(8);
+        unsigned long long value = 0;
+        for(int i=0; i<8; ++i) {
+            value |= (unsigned long long) data[i] << (8*i);
+        }
+        return value;
+    }
+
+
+    /** @brief Returns the number of bytes read
+     * @return The position within the buffer
+     */
+    size_t getPosition() const {
+        return myPosition;
+    }
+
+
+private:
+    /// @brief The buffer
+    const char *myBuffer;
+
+    /// @brief The length of the buffer
+    size_t myLength;
+
+    /// @brief The position within the buffer
+    size_t myPosition;
+
+
+};
+
+
+/** @brief Returns how the value of the given option is encoded
+ * @param[in] option The option
+ * @return The option's encoding type
+ */
+static WireValueType
+getWireType(const Option &option) {
+    if(dynamic_cast<const Option_Integer*>(&option)!=0 || dynamic_cast<const Option_TunableInteger*>(&option)!=0) {
+        return WIRE_INTEGER;
+    }
+    if(dynamic_cast<const Option_Double*>(&option)!=0 || dynamic_cast<const Option_TunableDouble*>(&option)!=0) {
+        return WIRE_DOUBLE;
+    }
+    if(dynamic_cast<const Option_Bool*>(&option)!=0) {
+        return WIRE_BOOL;
+    }
+    if(dynamic_cast<const Option_String*>(&option)!=0) {
+        return WIRE_STRING;
+    }
+    // other option types are shipped as their string representation
+    return WIRE_TEXT;
+}
+
+
+/** @brief Sets a decoded value to the given option
+ * @param[in] option The option to set
+ * @param[in] type The option's encoding type
+ * @param[in] number The value of numbers (zigzag-encoded for integers, the bits for doubles)
+ * @param[in] data The bytes of bools, strings, and texts
+ * @param[in] length The number of bytes of strings and texts
+ * @throw runtime_error If the option cannot be set or the value is not valid
+ */
+static void
+setWireValue(Option &option, WireValueType type, unsigned long long number, const char *data, size_t length) {
+    switch(type) {
+    case WIRE_INTEGER: {
+        const long long decoded = (long long) (number >> 1) ^ -(long long) (number & 1);
+        if(decoded<INT_MIN || decoded>INT_MAX) {
+            throw std::runtime_error("value is not within the range of an int");
+        }
+        const int value = (int) decoded;
+        Option_Integer *o = dynamic_cast<Option_Integer*>(&option);
+        if(o!=0) {
+            o->setValue(value);
+        } else {
+            static_cast<Option_TunableInteger&>(option).setValue(value);
+        }
+        break;
+    }
+    case WIRE_DOUBLE: {
+        double value;
+        memcpy(&value, &number, sizeof(value));
+        Option_Double *o = dynamic_cast<Option_Double*>(&option);
+        if(o!=0) {
+            o->setValue(value);
+        } else {
+            static_cast<Option_TunableDouble&>(option).setValue(value);
+        }
+        break;
+    }
+    case WIRE_BOOL:
+        static_cast<Option_Bool&>(option).setValue(*data!=0);
+        break;
+    case WIRE_STRING:
+        static_cast<Option_String&>(option).setValue(data, length);
+        break;
+    default:
+        option.set(std::string(data, length));
+        break;
+    }
+}
+
+
+
+/* =========================================================================
+ * method definitions
+ * ======================================================================= */
+size_t
+OptionsWireFormat::encode(const OptionsCont &options, char *buffer, size_t capacity) {
+    OptionsBitset given = options.getNonDefaultOptions();
+    WireWriter writer(buffer, capacity);
+    writer.writeFixed(options.getSchemaFingerprint());
+    writer.writeVarint(given.count());
+    for(size_t i=given.findNext(0); i<given.size(); i=given.findNext(i+1)) {
+        const Option &option = options.getOptionAt(i);
+        writer.writeVarint(i);
+        switch(getWireType(option)) {
+        case WIRE_INTEGER: {
+            long long value = dynamic_cast<const Option_Integer*>(&option)!=0
+                ? static_cast<const Option_Integer&>(option).getValue() : static_cast<const Option_TunableInteger&>(option).getValue();
+            // zigzag: small negative values stay short
+            writer.writeVarint(((unsigned long long) value << 1) ^ (unsigned long long) (value >> 63));
+            break;
+        }
+        case WIRE_DOUBLE: {
+            double value = dynamic_cast<const Option_Double*>(&option)!=0
+                ? static_cast<const Option_Double&>(option).getValue() : static_cast<const Option_TunableDouble&>(option).getValue();
+            unsigned long long bits;
+            memcpy(&bits, &value, sizeof(bits));
+            writer.writeFixed(bits);
+            break;
+        }
+        case WIRE_BOOL:
+            writer.write((unsigned char) (static_cast<const Option_Bool&>(option).getValue() ? 1 : 0));
+            break;
+        case WIRE_STRING: {
+            const std::string &value = static_cast<const Option_String&>(option).getValue();
+            writer.writeVarint(value.length());
+            writer.write(value.data(), value.length());
+            break;
+        }
+        default: {
+            std::string value = option.getValueAsString();
+            writer.writeVarint(value.length());
+            writer.write(value.data(), value.length());
+            break;
+        }
+        }
+    }
+    return writer.getSize();
+}
+
+
+size_t
+OptionsWireFormat::decode(OptionsCont &into, const char *buffer, size_t length) {
+    // decode the values into copies of the options, so that the encoding
+    //  and the values are checked completely before anything is set
+    WireReader reader(buffer, length);
+    if(reader.readFixed()!=into.getSchemaFingerprint()) {
+        throw std::runtime_error("The encoded options do not match the known options.");
+    }
+    const unsigned long long setNumber = reader.readVarint();
+    const size_t number = into.getOptionNumber();
+    if(setNumber>number) {
+        throw std::runtime_error("The encoded options are invalid.");
+    }
+    std::vector<bool> seen(number, false);
+    std::vector<std::pair<size_t, std::shared_ptr<Option> > > values;
+    values.reserve((size_t) setNumber);
+    for(unsigned long long i=0; i<setNumber; ++i) {
+        unsigned long long id = reader.readVarint();
+        if(id>=number || seen[(size_t) id]) {
+            throw std::runtime_error("The encoded options are invalid.");
+        }
+        seen[(size_t) id] = true;
+        const Option &option = into.getOptionAt((size_t) id);
+        const WireValueType type = getWireType(option);
+        unsigned long long value = 0;
+        const char *data = 0;
+        size_t valueLength = 0;
+        switch(type) {
+        case WIRE_INTEGER:
+            value = reader.readVarint();
+            break;
+        case WIRE_DOUBLE:
+            value = reader.readFixed();
+            break;
+        case WIRE_BOOL:
+            data = reader.read(1);
+            break;
+        default:
+            valueLength = (size_t) reader.readVarint();
+            data = reader.read(valueLength);
+            break;
+        }
+        std::shared_ptr<Option> copy(option.clone());
+        try {
+            if(!option.canBeSet()) {
+                throw std::runtime_error("This option was already set.");
+            }
+            setWireValue(*copy, type, value, data, valueLength);
+        } catch(std::runtime_error &e) {
+            throw std::runtime_error("Could not set option '" + into.getOptionNameAt((size_t) id) + "'; reason: " + e.what());
+        }
+        values.push_back(std::make_pair((size_t) id, copy));
+    }
+    // set the values; subscribers are informed if the value's string representation changes
+    OptionsBatchScope batch(into);
+    for(std::vector<std::pair<size_t, std::shared_ptr<Option> > >::const_iterator i=values.begin(); i!=values.end(); ++i) {
+        into.restore((*i).first, *(*i).second);
+    }
+    return reader.getPosition();
+}
+
+
+// *************************************************************************
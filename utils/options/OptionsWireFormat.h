@@ -0,0 +1,101 @@
+#ifndef OptionsWireFormat_h
+#define OptionsWireFormat_h
+/** ************************************************************************
+   @project      options library
+   @file         OptionsWireFormat.h
+   @since        18.10.2026
+   @author       Daniel Krajzewicz (daniel@krajzewicz.de)
+   @copyright    Eclipse Public License v2.0 (EPL v2.0), (c) Daniel Krajzewicz 2026-
+   *********************************************************************** */
+
+/* =========================================================================
+ * global configuration import
+ * ======================================================================= */
+#if defined _MSC_VER || defined __BORLANDC__
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+
+
+/* =========================================================================
+ * included modules
+ * ======================================================================= */
+#include <cstddef>
+
+/* -------------------------------------------------------------------
+ * (optional) memory checking
+ * ----------------------------------------------------------------- */
+#ifdef DEBUG_ALLOC_NVWA
+#include <debug_new.h>
+#endif
+
+
+
+/* =========================================================================
+ * class declarations
+ * ======================================================================= */
+class OptionsCont;
+
+
+
+/* =========================================================================
+ * class definitions
+ * ======================================================================= */
+/**
+ * @class OptionsWireFormat
+ * @brief Encodes the set values of options into a compact binary form and decodes them
+ *
+ * The encoding starts with the options' fingerprint (see
+ *  OptionsCont::getSchemaFingerprint) and the number of values, followed
+ *  by the values as pairs of option ID and value. IDs, lengths, and
+ *  integers are stored as variable-length integers (integers zigzag-coded),
+ *  doubles as their raw 8 bytes, bools as one byte, strings as their
+ *  length and characters. All multi-byte values are little-endian.
+ *
+ * Only values that were set (and are not the defaults) are encoded; the
+ *  decoding side must have been built by the same code, which is checked
+ *  using the fingerprint.
+ *
+ * Encoding and decoding work on buffers given by the caller. Encoding
+ *  allocates memory only for the set-options bitset and for values shipped
+ *  as text (options other than integer, double, bool, and string ones);
+ *  decoding checks the values on copies of the options given in the
+ *  encoding before setting any, and so allocates these copies.
+ */
+class OptionsWireFormat {
+public:
+    /** @brief Encodes the set values of the given options
+     *
+     * Nothing is written beyond the buffer's capacity; if the returned size
+     *  exceeds the capacity, the buffer was too small and the encoding is
+     *  incomplete.
+     * @param[in] options The options to encode
+     * @param[out] buffer The buffer to write into
+     * @param[in] capacity The size of the buffer
+     * @return The size of the encoding
+     */
+    static size_t encode(const OptionsCont &options, char *buffer, size_t capacity);
+
+
+    /** @brief Decodes values into the given options
+     *
+     * The encoding and all values are checked completely before any option
+     *  is set (each option may be given once, the values must be valid for
+     *  the options, see Option::validate); if a check fails, no option is
+     *  changed. Subscribers are informed about the changes in one batch.
+     * @param[in] into The options to set
+     * @param[in] buffer The encoding
+     * @param[in] length The length of the encoding
+     * @return The number of bytes read
+     * @throw runtime_error If the encoding is truncated, does not match the options, gives an option twice, sets an option that was already set, or a value is invalid (including integers beyond the range of an int)
+     */
+    static size_t decode(OptionsCont &into, const char *buffer, size_t length);
+
+
+};
+
+
+// *************************************************************************
+#endif
@@ -35,7 +35,7 @@
 #include <iostream>
 #include <string>
 #include "OptionsXercesHandler.h"
-#include "OptionsCont.h"
+#include "OptionsParsedConfiguration.h"
 
 /* -------------------------------------------------------------------------
  * (optional) memory checking
@@ -57,8 +57,8 @@ using namespace XERCES_CPP_NAMESPACE;
 /* =========================================================================
  * method definitions
  * ======================================================================= */
-OptionsXercesHandler::OptionsXercesHandler(OptionsCont &options, const std::string &file) 
-    : myOptions(options), myHadError(false), myFileName(file) {
+OptionsXercesHandler::OptionsXercesHandler(OptionsParsedConfiguration &configuration, const std::string &file) 
+    : myConfiguration(configuration), myHaveValue(false), myHadError(false), myFileName(file) {
 }
 
 
@@ -69,15 +69,31 @@ OptionsXercesHandler::~OptionsXercesHandler() {
 void
 OptionsXercesHandler::startElement(const XMLCh* const uri, const XMLCh* const localname, const XMLCh* const qname, const Attributes& attrs) {
     myCurrentOptionName = convert(localname);
+    myCurrentValue.clear();
+    myHaveValue = false;
 }
 
 
 void
 OptionsXercesHandler::characters(const XMLCh* const chars, const XMLSize_t length) {
-    if(myOptions.contains(myCurrentOptionName) && myOptions.canBeSet(myCurrentOptionName)) {
-        myOptions.set(myCurrentOptionName, convert(chars));
+    if(myCurrentOptionName!="") {
+        for(XMLSize_t i=0; i<length; ++i) {
+            myCurrentValue += (char) chars[i];
+        }
+        myHaveValue = true;
+    }
+}
+
+
+void
+OptionsXercesHandler::endElement(const XMLCh* const uri, const XMLCh* const localname, const XMLCh* const qname) {
+    // elements enclosing others (e.g. the root) were left by their children
+    if(myCurrentOptionName!="" && myHaveValue) {
+        myConfiguration.add(myCurrentOptionName, myCurrentValue);
     }
     myCurrentOptionName = "";
+    myCurrentValue.clear();
+    myHaveValue = false;
 }
 
 
@@ -43,7 +43,7 @@
 /* =========================================================================
  * class declarations
  * ======================================================================= */
-class OptionsCont;
+class OptionsParsedConfiguration;
 
 
 /* =========================================================================
@@ -59,10 +59,10 @@ class OptionsCont;
 class OptionsXercesHandler : public XERCES_CPP_NAMESPACE_QUALIFIER DefaultHandler {
 public:
     /** @brief Constructor
-	 * @param[in] options The options to fill
+	 * @param[in] configuration The parsed configuration to fill
 	 * @param[in] file The configuration file to load
      */
-    OptionsXercesHandler(OptionsCont &options, const std::string &file);
+    OptionsXercesHandler(OptionsParsedConfiguration &configuration, const std::string &file);
 
 
     /// @brief Destructor
@@ -80,8 +80,18 @@ public:
                       const XERCES_CPP_NAMESPACE_QUALIFIER Attributes& attrs);
 
 
-    /** @brief Called if characters shall be processed */
+    /** @brief Called if characters shall be processed
+     *
+     * The characters of an element may be given in several chunks; they are
+     *  collected until the element ends.
+     */
     void characters(const XMLCh* const chars, const XMLSize_t length);
+
+
+    /** @brief Called if an element ends; stores the collected value of an option
+	 */
+    void endElement(const XMLCh* const uri, const XMLCh* const localname,
+                    const XMLCh* const qname);
     //}
 
 
@@ -117,12 +127,18 @@ public:
 
 
 private:
-    /// @brief The options to fill
-    OptionsCont &myOptions;
+    /// @brief The parsed configuration to fill
+    OptionsParsedConfiguration &myConfiguration;
 
     /// @brief The name of the current option to set
     std::string myCurrentOptionName;
 
+    /// @brief The characters of the current option's value collected so far
+    std::string myCurrentValue;
+
+    /// @brief Whether characters were given for the current option
+    bool myHaveValue;
+
     /// @brief Information whether an error occured
     bool myHadError;
 